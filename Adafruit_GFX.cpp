@@ -34,7 +34,9 @@
  */
 
 #include "Adafruit_GFX.h"
+#include "Adafruit_GFX_Profile.h"
 #include "glcdfont.h"
+#include "gfxbezier.h"
 #undef abs
 
 #include <algorithm>
@@ -42,11 +44,12 @@
 #include <cstring>
 
 
-Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h)
+Adafruit_GFX::Adafruit_GFX(gfx_coord_t w, gfx_coord_t h)
     : WIDTH(w), HEIGHT(h), _width { WIDTH }, _height { HEIGHT }, cursor_x {}, cursor_y {}, textcolor { 0xffff },
-      textbgcolor { 0xffff }, textsize { 1 }, rotation {}, wrap { true }, _cp437 { false }, gfxFont { nullptr } {}
+      textbgcolor { 0xffff }, texteffectcolor {}, texteffect { GFXtextEffect::None }, texteffectprev { -1 }, texteffectprevx {}, texteffectprevy {},
+      textsize { 1 }, rotation {}, wrap { true }, _cp437 { false }, gfxFont { nullptr } {}
 
-void Adafruit_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+void Adafruit_GFX::writeLine(gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t x1, gfx_coord_t y1, uint16_t color) {
     const bool steep { abs(y1 - y0) > abs(x1 - x0) };
     if (steep) {
         std::swap(x0, y0);
@@ -58,11 +61,11 @@ void Adafruit_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uin
         std::swap(y0, y1);
     }
 
-    const int16_t dx { static_cast<int16_t>(x1 - x0) };
-    const int16_t dy { static_cast<int16_t>(std::abs(y1 - y0)) };
+    const gfx_coord_t dx { static_cast<gfx_coord_t>(x1 - x0) };
+    const gfx_coord_t dy { static_cast<gfx_coord_t>(std::abs(y1 - y0)) };
 
-    int16_t err { static_cast<int16_t>(dx / 2) };
-    int16_t ystep;
+    gfx_coord_t err { static_cast<gfx_coord_t>(dx / 2) };
+    gfx_coord_t ystep;
 
     if (y0 < y1) {
         ystep = 1;
@@ -84,27 +87,99 @@ void Adafruit_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uin
     }
 }
 
-void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+void Adafruit_GFX::writeRGBSpan(gfx_coord_t x, gfx_coord_t y, const uint16_t colors[], gfx_coord_t w) {
+    for (gfx_coord_t i { 0 }; i < w; i++) {
+        writePixel(x + i, y, colors[i]);
+    }
+}
+
+void Adafruit_GFX::writeLineSpans(gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t x1, gfx_coord_t y1, uint16_t color, bool skip_first) {
+    const bool steep { abs(y1 - y0) > abs(x1 - x0) };
+    if (steep) {
+        std::swap(x0, y0);
+        std::swap(x1, y1);
+    }
+
+    const bool reversed { x0 > x1 };
+    if (reversed) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+    }
+
+    // Range of the major axis to write; the skipped start point is at the far end if the line was reversed
+    gfx_coord_t first { x0 };
+    gfx_coord_t last { x1 };
+    if (skip_first) {
+        if (reversed) {
+            --last;
+        } else {
+            ++first;
+        }
+    }
+
+    const gfx_coord_t dx { static_cast<gfx_coord_t>(x1 - x0) };
+    const gfx_coord_t dy { static_cast<gfx_coord_t>(std::abs(y1 - y0)) };
+    const gfx_coord_t ystep { static_cast<gfx_coord_t>(y0 < y1 ? 1 : -1) };
+    gfx_coord_t err { static_cast<gfx_coord_t>(dx / 2) };
+
+    auto run = [&](gfx_coord_t a, gfx_coord_t b, gfx_coord_t minor) {
+        a = std::max(a, first);
+        b = std::min(b, last);
+        if (a > b) {
+            return;
+        }
+        if (a == b) {
+            if (steep) {
+                writePixel(minor, a, color);
+            } else {
+                writePixel(a, minor, color);
+            }
+        } else if (steep) {
+            writeFastVLine(minor, a, b - a + 1, color);
+        } else {
+            writeFastHLine(a, minor, b - a + 1, color);
+        }
+    };
+
+    // Same decisions as writeLine(), but pixels sharing the minor coordinate are collected into one run
+    gfx_coord_t start { x0 };
+    for (gfx_coord_t x { x0 }; x <= x1; x++) {
+        err -= dy;
+        if (err < 0) {
+            run(start, x, y0);
+            y0 += ystep;
+            err += dx;
+            start = x + 1;
+        }
+    }
+    run(start, x1, y0);
+}
+
+void Adafruit_GFX::drawFastVLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t h, uint16_t color) {
+    GFX_PROFILE_FUNCTION();
     startWrite();
     writeLine(x, y, x, y + h - 1, color);
     endWrite();
 }
 
-void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+void Adafruit_GFX::drawFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) {
+    GFX_PROFILE_FUNCTION();
     startWrite();
     writeLine(x, y, x + w - 1, y, color);
     endWrite();
 }
 
-void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+void Adafruit_GFX::fillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) {
+    GFX_PROFILE_FUNCTION();
     startWrite();
-    for (int16_t i { x }; i < x + w; i++) {
+    for (gfx_coord_t i { x }; i < x + w; i++) {
         writeFastVLine(i, y, h, color);
     }
     endWrite();
 }
 
-void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+void Adafruit_GFX::drawLine(gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t x1, gfx_coord_t y1, uint16_t color) {
+    GFX_PROFILE_FUNCTION();
     if (x0 == x1) {
         if (y0 > y1) {
             std::swap(y0, y1);
@@ -122,12 +197,13 @@ void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint
     }
 }
 
-void Adafruit_GFX::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
-    int16_t f { static_cast<int16_t>(1 - r) };
-    int16_t ddF_x { 1 };
-    int16_t ddF_y { static_cast<int16_t>(-2 * r) };
-    int16_t x { 0 };
-    int16_t y { r };
+void Adafruit_GFX::drawCircle(gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t r, uint16_t color) {
+    GFX_PROFILE_FUNCTION();
+    gfx_coord_t f { static_cast<gfx_coord_t>(1 - r) };
+    gfx_coord_t ddF_x { 1 };
+    gfx_coord_t ddF_y { static_cast<gfx_coord_t>(-2 * r) };
+    gfx_coord_t x { 0 };
+    gfx_coord_t y { r };
 
     startWrite();
     writePixel(x0, y0 + r, color);
@@ -157,12 +233,13 @@ void Adafruit_GFX::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
     endWrite();
 }
 
-void Adafruit_GFX::drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, uint16_t color) {
-    int16_t f { static_cast<int16_t>(1 - r) };
-    int16_t ddF_x { 1 };
-    int16_t ddF_y { static_cast<int16_t>(-2 * r) };
-    int16_t x { 0 };
-    int16_t y { r };
+void Adafruit_GFX::drawCircleHelper(gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t r, uint8_t cornername, uint16_t color) {
+    GFX_PROFILE_FUNCTION();
+    gfx_coord_t f { static_cast<gfx_coord_t>(1 - r) };
+    gfx_coord_t ddF_x { 1 };
+    gfx_coord_t ddF_y { static_cast<gfx_coord_t>(-2 * r) };
+    gfx_coord_t x { 0 };
+    gfx_coord_t y { r };
 
     while (x < y) {
         if (f >= 0) {
@@ -192,21 +269,23 @@ void Adafruit_GFX::drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t c
     }
 }
 
-void Adafruit_GFX::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+void Adafruit_GFX::fillCircle(gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t r, uint16_t color) {
+    GFX_PROFILE_FUNCTION();
     startWrite();
     writeFastVLine(x0, y0 - r, 2 * r + 1, color);
     fillCircleHelper(x0, y0, r, 3, 0, color);
     endWrite();
 }
 
-void Adafruit_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta, uint16_t color) {
-    int16_t f { static_cast<int16_t>(1 - r) };
-    int16_t ddF_x { 1 };
-    int16_t ddF_y { static_cast<int16_t>(-2 * r) };
-    int16_t x { 0 };
-    int16_t y { r };
-    int16_t px { x };
-    int16_t py { y };
+void Adafruit_GFX::fillCircleHelper(gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t r, uint8_t corners, gfx_coord_t delta, uint16_t color) {
+    GFX_PROFILE_FUNCTION();
+    gfx_coord_t f { static_cast<gfx_coord_t>(1 - r) };
+    gfx_coord_t ddF_x { 1 };
+    gfx_coord_t ddF_y { static_cast<gfx_coord_t>(-2 * r) };
+    gfx_coord_t x { 0 };
+    gfx_coord_t y { r };
+    gfx_coord_t px { x };
+    gfx_coord_t py { y };
 
     delta++; // Avoid some +1's in the loop
 
@@ -242,7 +321,8 @@ void Adafruit_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t c
     }
 }
 
-void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+void Adafruit_GFX::drawRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) {
+    GFX_PROFILE_FUNCTION();
     startWrite();
     writeFastHLine(x, y, w, color);
     writeFastHLine(x, y + h - 1, w, color);
@@ -251,8 +331,9 @@ void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t
     endWrite();
 }
 
-void Adafruit_GFX::drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
-    int16_t max_radius { static_cast<int16_t>(((w < h) ? w : h) / 2) }; // 1/2 minor axis
+void Adafruit_GFX::drawRoundRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, gfx_coord_t r, uint16_t color) {
+    GFX_PROFILE_FUNCTION();
+    gfx_coord_t max_radius { static_cast<gfx_coord_t>(((w < h) ? w : h) / 2) }; // 1/2 minor axis
     if (r > max_radius) {
         r = max_radius;
     }
@@ -270,8 +351,9 @@ void Adafruit_GFX::drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int
     endWrite();
 }
 
-void Adafruit_GFX::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
-    int16_t max_radius { static_cast<int16_t>(((w < h) ? w : h) / 2) }; // 1/2 minor axis
+void Adafruit_GFX::fillRoundRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, gfx_coord_t r, uint16_t color) {
+    GFX_PROFILE_FUNCTION();
+    gfx_coord_t max_radius { static_cast<gfx_coord_t>(((w < h) ? w : h) / 2) }; // 1/2 minor axis
     if (r > max_radius) {
         r = max_radius;
     }
@@ -284,14 +366,16 @@ void Adafruit_GFX::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int
     endWrite();
 }
 
-void Adafruit_GFX::drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+void Adafruit_GFX::drawTriangle(gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t x1, gfx_coord_t y1, gfx_coord_t x2, gfx_coord_t y2, uint16_t color) {
+    GFX_PROFILE_FUNCTION();
     drawLine(x0, y0, x1, y1, color);
     drawLine(x1, y1, x2, y2, color);
     drawLine(x2, y2, x0, y0, color);
 }
 
-void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
-    int16_t a, b, y, last;
+void Adafruit_GFX::fillTriangle(gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t x1, gfx_coord_t y1, gfx_coord_t x2, gfx_coord_t y2, uint16_t color) {
+    GFX_PROFILE_FUNCTION();
+    gfx_coord_t a, b, y, last;
 
     // Sort coordinates by Y order (y2 >= y1 >= y0)
     if (y0 > y1) {
@@ -325,12 +409,12 @@ void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
         return;
     }
 
-    int16_t dx01 { static_cast<int16_t>(x1 - x0) };
-    int16_t dy01 { static_cast<int16_t>(y1 - y0) };
-    int16_t dx02 { static_cast<int16_t>(x2 - x0) };
-    int16_t dy02 { static_cast<int16_t>(y2 - y0) };
-    int16_t dx12 { static_cast<int16_t>(x2 - x1) };
-    int16_t dy12 { static_cast<int16_t>(y2 - y1) };
+    gfx_coord_t dx01 { static_cast<gfx_coord_t>(x1 - x0) };
+    gfx_coord_t dy01 { static_cast<gfx_coord_t>(y1 - y0) };
+    gfx_coord_t dx02 { static_cast<gfx_coord_t>(x2 - x0) };
+    gfx_coord_t dy02 { static_cast<gfx_coord_t>(y2 - y0) };
+    gfx_coord_t dx12 { static_cast<gfx_coord_t>(x2 - x1) };
+    gfx_coord_t dy12 { static_cast<gfx_coord_t>(y2 - y1) };
     int32_t sa { 0 };
     int32_t sb { 0 };
 
@@ -382,13 +466,83 @@ void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
     endWrite();
 }
 
-void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color) {
-    int16_t byteWidth { static_cast<int16_t>((w + 7) / 8) }; // Bitmap scanline pad = whole byte
+void Adafruit_GFX::drawQuadBezier(gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t x1, gfx_coord_t y1, gfx_coord_t x2, gfx_coord_t y2, uint16_t color) {
+    GFX_PROFILE_FUNCTION();
+    const gfx_coord_t points[] { x0, y0, x1, y1, x2, y2 };
+    drawQuadSpline(points, 3, color);
+}
+
+void Adafruit_GFX::drawCubicBezier(
+    gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t x1, gfx_coord_t y1, gfx_coord_t x2, gfx_coord_t y2, gfx_coord_t x3, gfx_coord_t y3, uint16_t color) {
+    GFX_PROFILE_FUNCTION();
+    const gfx_coord_t points[] { x0, y0, x1, y1, x2, y2, x3, y3 };
+    drawCubicSpline(points, 4, color);
+}
+
+void Adafruit_GFX::drawQuadSpline(const gfx_coord_t points[], uint16_t count, uint16_t color) {
+    GFX_PROFILE_FUNCTION();
+    if (count < 3) {
+        return;
+    }
+
+    gfx_coord_t x { points[0] };
+    gfx_coord_t y { points[1] };
+    // Each flat segment continues at the last written pixel, so shared pixels aren't written twice
+    auto segment = [this, &x, &y, color](int32_t fx, int32_t fy) {
+        const gfx_coord_t nx { static_cast<gfx_coord_t>((fx + 128) >> gfx_bezier::FRAC_BITS) };
+        const gfx_coord_t ny { static_cast<gfx_coord_t>((fy + 128) >> gfx_bezier::FRAC_BITS) };
+        if ((nx != x) || (ny != y)) {
+            writeLineSpans(x, y, nx, ny, color, true);
+            x = nx;
+            y = ny;
+        }
+    };
+
+    startWrite();
+    writePixel(x, y, color);
+    for (uint16_t i { 0 }; i + 2 < count; i += 2) {
+        const gfx_coord_t* p { &points[2 * i] };
+        gfx_bezier::flattenQuad(p[0] * 256, p[1] * 256, p[2] * 256, p[3] * 256, p[4] * 256, p[5] * 256, segment);
+    }
+    endWrite();
+}
+
+void Adafruit_GFX::drawCubicSpline(const gfx_coord_t points[], uint16_t count, uint16_t color) {
+    GFX_PROFILE_FUNCTION();
+    if (count < 4) {
+        return;
+    }
+
+    gfx_coord_t x { points[0] };
+    gfx_coord_t y { points[1] };
+    // Each flat segment continues at the last written pixel, so shared pixels aren't written twice
+    auto segment = [this, &x, &y, color](int32_t fx, int32_t fy) {
+        const gfx_coord_t nx { static_cast<gfx_coord_t>((fx + 128) >> gfx_bezier::FRAC_BITS) };
+        const gfx_coord_t ny { static_cast<gfx_coord_t>((fy + 128) >> gfx_bezier::FRAC_BITS) };
+        if ((nx != x) || (ny != y)) {
+            writeLineSpans(x, y, nx, ny, color, true);
+            x = nx;
+            y = ny;
+        }
+    };
+
+    startWrite();
+    writePixel(x, y, color);
+    for (uint16_t i { 0 }; i + 3 < count; i += 3) {
+        const gfx_coord_t* p { &points[2 * i] };
+        gfx_bezier::flattenCubic(p[0] * 256, p[1] * 256, p[2] * 256, p[3] * 256, p[4] * 256, p[5] * 256, p[6] * 256, p[7] * 256, segment);
+    }
+    endWrite();
+}
+
+void Adafruit_GFX::drawBitmap(gfx_coord_t x, gfx_coord_t y, const uint8_t bitmap[], gfx_coord_t w, gfx_coord_t h, uint16_t color) {
+    GFX_PROFILE_FUNCTION();
+    gfx_coord_t byteWidth { static_cast<gfx_coord_t>((w + 7) / 8) }; // Bitmap scanline pad = whole byte
     uint8_t byte { 0 };
 
     startWrite();
-    for (int16_t j { 0 }; j < h; j++, y++) {
-        for (int16_t i { 0 }; i < w; i++) {
+    for (gfx_coord_t j { 0 }; j < h; j++, y++) {
+        for (gfx_coord_t i { 0 }; i < w; i++) {
             if (i & 7) {
                 byte <<= 1;
             } else {
@@ -402,13 +556,14 @@ void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int1
     endWrite();
 }
 
-void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg) {
-    int16_t byteWidth { static_cast<int16_t>((w + 7) / 8) }; // Bitmap scanline pad = whole byte
+void Adafruit_GFX::drawBitmap(gfx_coord_t x, gfx_coord_t y, const uint8_t bitmap[], gfx_coord_t w, gfx_coord_t h, uint16_t color, uint16_t bg) {
+    GFX_PROFILE_FUNCTION();
+    gfx_coord_t byteWidth { static_cast<gfx_coord_t>((w + 7) / 8) }; // Bitmap scanline pad = whole byte
     uint8_t byte { 0 };
 
     startWrite();
-    for (int16_t j { 0 }; j < h; j++, y++) {
-        for (int16_t i { 0 }; i < w; i++) {
+    for (gfx_coord_t j { 0 }; j < h; j++, y++) {
+        for (gfx_coord_t i { 0 }; i < w; i++) {
             if (i & 7) {
                 byte <<= 1;
             } else {
@@ -420,13 +575,14 @@ void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int1
     endWrite();
 }
 
-void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, uint8_t* bitmap, int16_t w, int16_t h, uint16_t color) {
-    int16_t byteWidth { static_cast<int16_t>((w + 7) / 8) }; // Bitmap scanline pad = whole byte
+void Adafruit_GFX::drawBitmap(gfx_coord_t x, gfx_coord_t y, uint8_t* bitmap, gfx_coord_t w, gfx_coord_t h, uint16_t color) {
+    GFX_PROFILE_FUNCTION();
+    gfx_coord_t byteWidth { static_cast<gfx_coord_t>((w + 7) / 8) }; // Bitmap scanline pad = whole byte
     uint8_t byte { 0 };
 
     startWrite();
-    for (int16_t j { 0 }; j < h; j++, y++) {
-        for (int16_t i { 0 }; i < w; i++) {
+    for (gfx_coord_t j { 0 }; j < h; j++, y++) {
+        for (gfx_coord_t i { 0 }; i < w; i++) {
             if (i & 7) {
                 byte <<= 1;
             } else {
@@ -439,13 +595,14 @@ void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, uint8_t* bitmap, int16_t w,
     endWrite();
 }
 
-void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, uint8_t* bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg) {
-    int16_t byteWidth { static_cast<int16_t>((w + 7) / 8) }; // Bitmap scanline pad = whole byte
+void Adafruit_GFX::drawBitmap(gfx_coord_t x, gfx_coord_t y, uint8_t* bitmap, gfx_coord_t w, gfx_coord_t h, uint16_t color, uint16_t bg) {
+    GFX_PROFILE_FUNCTION();
+    gfx_coord_t byteWidth { static_cast<gfx_coord_t>((w + 7) / 8) }; // Bitmap scanline pad = whole byte
     uint8_t byte { 0 };
 
     startWrite();
-    for (int16_t j { 0 }; j < h; j++, y++) {
-        for (int16_t i { 0 }; i < w; i++) {
+    for (gfx_coord_t j { 0 }; j < h; j++, y++) {
+        for (gfx_coord_t i { 0 }; i < w; i++) {
             if (i & 7) {
                 byte <<= 1;
             } else {
@@ -457,13 +614,14 @@ void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, uint8_t* bitmap, int16_t w,
     endWrite();
 }
 
-void Adafruit_GFX::drawXBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color) {
-    int16_t byteWidth { static_cast<int16_t>((w + 7) / 8) }; // Bitmap scanline pad = whole byte
+void Adafruit_GFX::drawXBitmap(gfx_coord_t x, gfx_coord_t y, const uint8_t bitmap[], gfx_coord_t w, gfx_coord_t h, uint16_t color) {
+    GFX_PROFILE_FUNCTION();
+    gfx_coord_t byteWidth { static_cast<gfx_coord_t>((w + 7) / 8) }; // Bitmap scanline pad = whole byte
     uint8_t byte { 0 };
 
     startWrite();
-    for (int16_t j { 0 }; j < h; j++, y++) {
-        for (int16_t i { 0 }; i < w; i++) {
+    for (gfx_coord_t j { 0 }; j < h; j++, y++) {
+        for (gfx_coord_t i { 0 }; i < w; i++) {
             if (i & 7) {
                 byte >>= 1;
             } else {
@@ -479,32 +637,35 @@ void Adafruit_GFX::drawXBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int
     endWrite();
 }
 
-void Adafruit_GFX::drawGrayscaleBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h) {
+void Adafruit_GFX::drawGrayscaleBitmap(gfx_coord_t x, gfx_coord_t y, const uint8_t bitmap[], gfx_coord_t w, gfx_coord_t h) {
+    GFX_PROFILE_FUNCTION();
     startWrite();
-    for (int16_t j { 0 }; j < h; j++, y++) {
-        for (int16_t i { 0 }; i < w; i++) {
+    for (gfx_coord_t j { 0 }; j < h; j++, y++) {
+        for (gfx_coord_t i { 0 }; i < w; i++) {
             writePixel(x + i, y, bitmap[j * w + i]);
         }
     }
     endWrite();
 }
 
-void Adafruit_GFX::drawGrayscaleBitmap(int16_t x, int16_t y, uint8_t* bitmap, int16_t w, int16_t h) {
+void Adafruit_GFX::drawGrayscaleBitmap(gfx_coord_t x, gfx_coord_t y, uint8_t* bitmap, gfx_coord_t w, gfx_coord_t h) {
+    GFX_PROFILE_FUNCTION();
     startWrite();
-    for (int16_t j { 0 }; j < h; j++, y++) {
-        for (int16_t i { 0 }; i < w; i++) {
+    for (gfx_coord_t j { 0 }; j < h; j++, y++) {
+        for (gfx_coord_t i { 0 }; i < w; i++) {
             writePixel(x + i, y, bitmap[j * w + i]);
         }
     }
     endWrite();
 }
 
-void Adafruit_GFX::drawGrayscaleBitmap(int16_t x, int16_t y, const uint8_t bitmap[], const uint8_t mask[], int16_t w, int16_t h) {
-    int16_t bw { static_cast<int16_t>((w + 7) / 8) }; // Bitmask scanline pad = whole byte
+void Adafruit_GFX::drawGrayscaleBitmap(gfx_coord_t x, gfx_coord_t y, const uint8_t bitmap[], const uint8_t mask[], gfx_coord_t w, gfx_coord_t h) {
+    GFX_PROFILE_FUNCTION();
+    gfx_coord_t bw { static_cast<gfx_coord_t>((w + 7) / 8) }; // Bitmask scanline pad = whole byte
     uint8_t byte { 0 };
     startWrite();
-    for (int16_t j { 0 }; j < h; j++, y++) {
-        for (int16_t i { 0 }; i < w; i++) {
+    for (gfx_coord_t j { 0 }; j < h; j++, y++) {
+        for (gfx_coord_t i { 0 }; i < w; i++) {
             if (i & 7) {
                 byte <<= 1;
             } else {
@@ -518,12 +679,13 @@ void Adafruit_GFX::drawGrayscaleBitmap(int16_t x, int16_t y, const uint8_t bitma
     endWrite();
 }
 
-void Adafruit_GFX::drawGrayscaleBitmap(int16_t x, int16_t y, uint8_t* bitmap, uint8_t* mask, int16_t w, int16_t h) {
-    int16_t bw { static_cast<int16_t>((w + 7) / 8) }; // Bitmask scanline pad = whole byte
+void Adafruit_GFX::drawGrayscaleBitmap(gfx_coord_t x, gfx_coord_t y, uint8_t* bitmap, uint8_t* mask, gfx_coord_t w, gfx_coord_t h) {
+    GFX_PROFILE_FUNCTION();
+    gfx_coord_t bw { static_cast<gfx_coord_t>((w + 7) / 8) }; // Bitmask scanline pad = whole byte
     uint8_t byte { 0 };
     startWrite();
-    for (int16_t j { 0 }; j < h; j++, y++) {
-        for (int16_t i { 0 }; i < w; i++) {
+    for (gfx_coord_t j { 0 }; j < h; j++, y++) {
+        for (gfx_coord_t i { 0 }; i < w; i++) {
             if (i & 7) {
                 byte <<= 1;
             } else {
@@ -537,32 +699,166 @@ void Adafruit_GFX::drawGrayscaleBitmap(int16_t x, int16_t y, uint8_t* bitmap, ui
     endWrite();
 }
 
-void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w, int16_t h) {
+void Adafruit_GFX::drawGrayscaleBitmap(gfx_coord_t x, gfx_coord_t y, const uint8_t bitmap[], gfx_coord_t w, gfx_coord_t h, uint16_t fg, uint16_t bg,
+    uint8_t depth) {
+    GFX_PROFILE_FUNCTION();
+    if ((depth != 4) && (depth != 8)) {
+        return;
+    }
+    // blend565() resolves alpha to 33 steps, a table of these covers 8- and 4-bit values exactly
+    uint16_t lut[33];
+    for (uint8_t i { 0 }; i < 33; i++) {
+        lut[i] = blend565(fg, bg, i < 32 ? static_cast<uint8_t>(i * 8) : 255);
+    }
+
+    constexpr gfx_coord_t chunk { 32 };
+    const size_t stride { static_cast<size_t>(depth == 4 ? (w + 1) / 2 : w) };
+    uint16_t colors[chunk];
     startWrite();
-    for (int16_t j { 0 }; j < h; j++, y++) {
-        for (int16_t i { 0 }; i < w; i++) {
+    for (gfx_coord_t j { 0 }; j < h; j++, bitmap += stride) {
+        for (gfx_coord_t i { 0 }; i < w; i += chunk) {
+            const gfx_coord_t n { static_cast<gfx_coord_t>(std::min<int32_t>(w - i, chunk)) };
+            for (gfx_coord_t k { 0 }; k < n; k++) {
+                colors[k] = lut[(grayLevel(bitmap, i + k, depth) + 4) >> 3];
+            }
+            writeRGBSpan(x + i, y + j, colors, n);
+        }
+    }
+    endWrite();
+}
+
+void Adafruit_GFX::drawAlphaBitmap(gfx_coord_t x, gfx_coord_t y, const uint8_t bitmap[], gfx_coord_t w, gfx_coord_t h, uint16_t color, uint8_t depth) {
+    GFX_PROFILE_FUNCTION();
+    if ((depth != 4) && (depth != 8)) {
+        return;
+    }
+    constexpr gfx_coord_t chunk { 32 };
+    const size_t stride { static_cast<size_t>(depth == 4 ? (w + 1) / 2 : w) };
+    uint16_t colors[chunk];
+    uint8_t alpha[chunk];
+    bool readable { true };
+    for (gfx_coord_t j { 0 }; j < h; j++, bitmap += stride) {
+        gfx_coord_t i { 0 };
+        for (; readable && (i < w); i += chunk) {
+            const gfx_coord_t n { static_cast<gfx_coord_t>(std::min<int32_t>(w - i, chunk)) };
+            bool clear { true }, opaque { true };
+            for (gfx_coord_t k { 0 }; k < n; k++) {
+                alpha[k] = grayLevel(bitmap, i + k, depth);
+                clear &= !alpha[k];
+                opaque &= alpha[k] == 255;
+            }
+            if (clear) {
+                continue;
+            }
+            // Reading back is self-contained (panels run their own transaction), so it stays outside of startWrite()
+            if (opaque) {
+                std::fill(colors, colors + n, color);
+            } else if (readRGBSpan(x + i, y + j, colors, n)) {
+                for (gfx_coord_t k { 0 }; k < n; k++) {
+                    colors[k] = blend565(color, colors[k], alpha[k]);
+                }
+            } else {
+                readable = false;
+                break;
+            }
+            startWrite();
+            writeRGBSpan(x + i, y + j, colors, n);
+            endWrite();
+        }
+
+        if (!readable) {
+            // Rest of the row as runs of equal alpha, the target decides how to blend them
+            startWrite();
+            while (i < w) {
+                const uint8_t a { grayLevel(bitmap, i, depth) };
+                gfx_coord_t end { static_cast<gfx_coord_t>(i + 1) };
+                while ((end < w) && (grayLevel(bitmap, end, depth) == a)) {
+                    end++;
+                }
+                if (a) {
+                    writeFastHLineAlpha(x + i, y + j, end - i, color, a);
+                }
+                i = end;
+            }
+            endWrite();
+        }
+    }
+}
+
+void Adafruit_GFX::drawIndexedBitmap(gfx_coord_t x, gfx_coord_t y, const uint8_t bitmap[], const uint16_t palette[], gfx_coord_t w, gfx_coord_t h,
+    uint8_t depth, int16_t transparent) {
+    GFX_PROFILE_FUNCTION();
+    if ((depth != 1) && (depth != 2) && (depth != 4) && (depth != 8)) {
+        return;
+    }
+
+    constexpr gfx_coord_t chunk { 32 };
+    const size_t stride { static_cast<size_t>((static_cast<int32_t>(w) * depth + 7) / 8) };
+    uint16_t colors[chunk];
+    startWrite();
+    for (gfx_coord_t j { 0 }; j < h; j++, bitmap += stride) {
+        const uint8_t* p { bitmap };
+        uint8_t byte { 0 };
+        gfx_coord_t start { 0 }, n { 0 }; // Buffered run
+        for (gfx_coord_t i { 0 }; i < w; i++) {
+            if (!((i * depth) & 7)) {
+                byte = pgm_read_byte(p++);
+            }
+            const uint8_t index { static_cast<uint8_t>(byte >> (8 - depth)) };
+            byte <<= depth;
+
+            if (index == transparent) {
+                if (n) {
+                    writeRGBSpan(x + start, y + j, colors, n);
+                    n = 0;
+                }
+                continue;
+            }
+            if (!n) {
+                start = i;
+            }
+            colors[n++] = pgm_read_word(&palette[index]);
+            if (n == chunk) {
+                writeRGBSpan(x + start, y + j, colors, n);
+                n = 0;
+            }
+        }
+        if (n) {
+            writeRGBSpan(x + start, y + j, colors, n);
+        }
+    }
+    endWrite();
+}
+
+void Adafruit_GFX::drawRGBBitmap(gfx_coord_t x, gfx_coord_t y, const uint16_t bitmap[], gfx_coord_t w, gfx_coord_t h) {
+    GFX_PROFILE_FUNCTION();
+    startWrite();
+    for (gfx_coord_t j { 0 }; j < h; j++, y++) {
+        for (gfx_coord_t i { 0 }; i < w; i++) {
             writePixel(x + i, y, pgm_read_word(&bitmap[j * w + i]));
         }
     }
     endWrite();
 }
 
-void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w, int16_t h) {
+void Adafruit_GFX::drawRGBBitmap(gfx_coord_t x, gfx_coord_t y, uint16_t* bitmap, gfx_coord_t w, gfx_coord_t h) {
+    GFX_PROFILE_FUNCTION();
     startWrite();
-    for (int16_t j { 0 }; j < h; j++, y++) {
-        for (int16_t i { 0 }; i < w; i++) {
+    for (gfx_coord_t j { 0 }; j < h; j++, y++) {
+        for (gfx_coord_t i { 0 }; i < w; i++) {
             writePixel(x + i, y, bitmap[j * w + i]);
         }
     }
     endWrite();
 }
 
-void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], const uint8_t mask[], int16_t w, int16_t h) {
-    int16_t bw { static_cast<int16_t>((w + 7) / 8) }; // Bitmask scanline pad = whole byte
+void Adafruit_GFX::drawRGBBitmap(gfx_coord_t x, gfx_coord_t y, const uint16_t bitmap[], const uint8_t mask[], gfx_coord_t w, gfx_coord_t h) {
+    GFX_PROFILE_FUNCTION();
+    gfx_coord_t bw { static_cast<gfx_coord_t>((w + 7) / 8) }; // Bitmask scanline pad = whole byte
     uint8_t byte { 0 };
     startWrite();
-    for (int16_t j { 0 }; j < h; j++, y++) {
-        for (int16_t i { 0 }; i < w; i++) {
+    for (gfx_coord_t j { 0 }; j < h; j++, y++) {
+        for (gfx_coord_t i { 0 }; i < w; i++) {
             if (i & 7) {
                 byte <<= 1;
             } else {
@@ -576,12 +872,13 @@ void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[],
     endWrite();
 }
 
-void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, uint8_t* mask, int16_t w, int16_t h) {
-    int16_t bw { static_cast<int16_t>((w + 7) / 8) }; // Bitmask scanline pad = whole byte
+void Adafruit_GFX::drawRGBBitmap(gfx_coord_t x, gfx_coord_t y, uint16_t* bitmap, uint8_t* mask, gfx_coord_t w, gfx_coord_t h) {
+    GFX_PROFILE_FUNCTION();
+    gfx_coord_t bw { static_cast<gfx_coord_t>((w + 7) / 8) }; // Bitmask scanline pad = whole byte
     uint8_t byte { 0 };
     startWrite();
-    for (int16_t j { 0 }; j < h; j++, y++) {
-        for (int16_t i { 0 }; i < w; i++) {
+    for (gfx_coord_t j { 0 }; j < h; j++, y++) {
+        for (gfx_coord_t i { 0 }; i < w; i++) {
             if (i & 7) {
                 byte <<= 1;
             } else {
@@ -595,7 +892,161 @@ void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, uint8_t
     endWrite();
 }
 
-void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size) {
+void Adafruit_GFX::drawIcon(const GFXatlas* atlas, uint16_t id, gfx_coord_t x, gfx_coord_t y, uint16_t color) {
+    GFX_PROFILE_FUNCTION();
+    if (!atlas || (id >= atlas->count)) {
+        return;
+    }
+
+    const GFXatlasIcon& icon { atlas->icons[id] };
+    startWrite();
+    if (atlas->depth == 16) {
+        // writeRGBSpan() reads RAM, the PROGMEM rows are copied in chunks
+        constexpr uint8_t chunk { 32 };
+        uint16_t colors[chunk];
+        const uint16_t* row { reinterpret_cast<const uint16_t*>(atlas->bitmap) + static_cast<size_t>(icon.y) * atlas->width + icon.x };
+        for (uint8_t j { 0 }; j < icon.height; j++, row += atlas->width) {
+            for (uint16_t i { 0 }; i < icon.width; i += chunk) {
+                const uint8_t n { static_cast<uint8_t>(std::min<int>(icon.width - i, chunk)) };
+                for (uint8_t k { 0 }; k < n; k++) {
+                    colors[k] = pgm_read_word(&row[i + k]);
+                }
+                writeRGBSpan(x + i, y + j, colors, n);
+            }
+        }
+    } else {
+        const size_t stride { static_cast<size_t>((atlas->width + 7) / 8) };
+        for (uint8_t j { 0 }; j < icon.height; j++) {
+            const uint8_t* row { atlas->bitmap + (icon.y + j) * stride };
+            gfx_coord_t start { -1 };
+            for (gfx_coord_t i { 0 }; i <= icon.width; i++) {
+                const uint16_t bit { static_cast<uint16_t>(icon.x + i) };
+                const bool set { (i < icon.width) && (pgm_read_byte(&row[bit / 8]) & (0x80 >> (bit & 7))) };
+                if (set && (start < 0)) {
+                    start = i;
+                } else if (!set && (start >= 0)) {
+                    writeFastHLine(x + start, y + j, i - start, color);
+                    start = -1;
+                }
+            }
+        }
+    }
+    endWrite();
+}
+
+void Adafruit_GFX::drawNinePatch(const GFXninePatch* patch, gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h) {
+    GFX_PROFILE_FUNCTION();
+    if (!patch || (w <= 0) || (h <= 0)) {
+        return;
+    }
+
+    // Fixed borders, cut in proportion if the patch is drawn smaller than them
+    const int32_t left { patch->stretchX };
+    const int32_t right { patch->width - patch->stretchX - patch->stretchWidth };
+    const int32_t top { patch->stretchY };
+    const int32_t bottom { patch->height - patch->stretchY - patch->stretchHeight };
+    const gfx_coord_t lw { static_cast<gfx_coord_t>(left + right > w ? left * w / (left + right) : left) };
+    const gfx_coord_t rw { static_cast<gfx_coord_t>(left + right > w ? w - lw : right) };
+    const gfx_coord_t th { static_cast<gfx_coord_t>(top + bottom > h ? top * h / (top + bottom) : top) };
+    const gfx_coord_t bh { static_cast<gfx_coord_t>(top + bottom > h ? h - th : bottom) };
+    const gfx_coord_t mw { static_cast<gfx_coord_t>(w - lw - rw) };
+    const gfx_coord_t mh { static_cast<gfx_coord_t>(h - th - bh) };
+    const gfx_coord_t sh { static_cast<gfx_coord_t>(patch->stretchHeight) };
+
+    startWrite();
+    for (gfx_coord_t j { 0 }; j < th; j++) {
+        drawNinePatchRow(*patch, j, x, y + j, 1, 1, lw, mw, rw);
+    }
+    // Each stretchable row is scanned once for all of its repeats
+    for (gfx_coord_t j { 0 }; (j < sh) && (j < mh); j++) {
+        drawNinePatchRow(*patch, patch->stretchY + j, x, y + th + j, (mh - j + sh - 1) / sh, sh, lw, mw, rw);
+    }
+    for (gfx_coord_t j { 0 }; j < bh; j++) {
+        drawNinePatchRow(*patch, patch->height - bh + j, x, y + th + mh + j, 1, 1, lw, mw, rw);
+    }
+    endWrite();
+}
+
+void Adafruit_GFX::drawNinePatchRow(const GFXninePatch& patch, uint16_t row, gfx_coord_t x, gfx_coord_t y, gfx_coord_t count, gfx_coord_t step,
+    gfx_coord_t lw, gfx_coord_t mw, gfx_coord_t rw) {
+    const uint16_t* src { patch.bitmap + static_cast<size_t>(row) * patch.width };
+
+    // Left border, stretched part and right border, each as source pixels repeated over a destination width
+    const struct {
+        const uint16_t* pixels;
+        gfx_coord_t n;
+        gfx_coord_t x;
+        gfx_coord_t w;
+    } segments[] {
+        { src, lw, x, lw },
+        { src + patch.stretchX, static_cast<gfx_coord_t>(patch.stretchWidth), static_cast<gfx_coord_t>(x + lw), mw },
+        { src + patch.width - rw, rw, static_cast<gfx_coord_t>(x + lw + mw), rw },
+    };
+
+    constexpr gfx_coord_t chunk { 32 };
+    uint16_t colors[chunk];
+    for (const auto& s : segments) {
+        if ((s.w <= 0) || (s.n <= 0)) {
+            continue;
+        }
+        const uint16_t color { pgm_read_word(&s.pixels[0]) };
+        gfx_coord_t i { 1 };
+        while ((i < s.n) && (pgm_read_word(&s.pixels[i]) == color)) {
+            i++;
+        }
+
+        if (i == s.n) { // One color, fill
+            if (step == 1) {
+                writeFillRect(s.x, y, s.w, count, color);
+            } else {
+                for (gfx_coord_t k { 0 }; k < count; k++) {
+                    writeFastHLine(s.x, y + k * step, s.w, color);
+                }
+            }
+        } else if (s.n <= chunk) {
+            // writeRGBSpan() reads RAM: tile the PROGMEM pixels into the chunk once, for all repeats and rows
+            const gfx_coord_t period { static_cast<gfx_coord_t>(chunk / s.n * s.n) };
+            for (gfx_coord_t k { 0 }; k < period; k++) {
+                colors[k] = pgm_read_word(&s.pixels[k % s.n]);
+            }
+            for (gfx_coord_t k { 0 }; k < count; k++) {
+                for (gfx_coord_t off { 0 }; off < s.w; off += period) {
+                    writeRGBSpan(s.x + off, y + k * step, colors, std::min<gfx_coord_t>(period, s.w - off));
+                }
+            }
+        } else {
+            for (gfx_coord_t k { 0 }; k < count; k++) {
+                for (gfx_coord_t off { 0 }; off < s.w; off += chunk) {
+                    const gfx_coord_t n { static_cast<gfx_coord_t>(std::min<int32_t>(s.w - off, chunk)) };
+                    for (gfx_coord_t m { 0 }; m < n; m++) {
+                        colors[m] = pgm_read_word(&s.pixels[(off + m) % s.n]);
+                    }
+                    writeRGBSpan(s.x + off, y + k * step, colors, n);
+                }
+            }
+        }
+    }
+}
+
+void Adafruit_GFX::drawSpans(gfx_coord_t x, gfx_coord_t y, const GFXspan spans[], size_t count, uint16_t color, uint8_t size) {
+    GFX_PROFILE_FUNCTION();
+    startWrite();
+    for (size_t i { 0 }; i < count; i++) {
+        const GFXspan& s { spans[i] };
+        if (size == 1) {
+            writeFastHLine(x + s.x, y + s.y, s.w, color);
+        } else {
+            writeFillRect(x + s.x * size, y + s.y * size, s.w * size, size, color);
+        }
+    }
+    endWrite();
+}
+
+void Adafruit_GFX::drawChar(gfx_coord_t x, gfx_coord_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size) {
+    GFX_PROFILE_FUNCTION();
+    if ((texteffect != GFXtextEffect::None) && drawCharEffect(x, y, c, color, bg, size)) {
+        return;
+    }
     if (!gfxFont) { // 'Classic' built-in font
         if ((x >= _width) || // Clip right
             (y >= _height) || // Clip bottom
@@ -649,7 +1100,7 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t colo
         int8_t xo { glyph->xOffset };
         int8_t yo { glyph->yOffset };
         uint8_t xx, yy, bits { 0 }, bit { 0 };
-        int16_t xo16 { 0 }, yo16 { 0 };
+        gfx_coord_t xo16 { 0 }, yo16 { 0 };
 
         if (size > 1) {
             xo16 = xo;
@@ -694,6 +1145,129 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t colo
     } // End classic vs custom font
 }
 
+bool Adafruit_GFX::drawCharEffect(gfx_coord_t x, gfx_coord_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size, int16_t prev, gfx_coord_t prev_x,
+    gfx_coord_t prev_y) {
+    const GlyphMask glyph { glyphMask(c) };
+    if (glyph.w > 62) {
+        return false;
+    }
+
+    // Pixels of the previous glyph of a print() stay in the text color, as if all outlines were drawn first
+    GlyphMask before {};
+    int16_t before_dx { 0 }, before_dy { 0 };
+    if ((prev >= 0) && (size > 0)) {
+        before = glyphMask(static_cast<unsigned char>(prev));
+        before_dx = static_cast<int16_t>((prev_x - x) / size + before.xo - glyph.xo);
+        before_dy = static_cast<int16_t>((prev_y - y) / size + before.yo - glyph.yo);
+        if ((before.w > 62) || (before_dx <= -64) || (before_dx >= 64)) {
+            before.h = 0;
+        }
+    }
+
+    auto spread = [](uint64_t m) { return m | (m << 1) | (m >> 1); };
+
+    // Classic font with opaque background: the 6 x 8 cell is filled, effect pixels may extend beyond it
+    const uint64_t cell { (!gfxFont && (bg != color)) ? uint64_t { 0x7e } : 0 };
+
+    startWrite();
+    uint64_t above { 0 }, here { 0 };
+    uint64_t before_above { before.row(-2 - before_dy) }, before_here { before.row(-1 - before_dy) };
+    for (int16_t row { -1 }; row <= glyph.h; row++) {
+        const uint64_t below { glyph.row(row + 1) };
+        const uint64_t fill { here };
+        uint64_t covered { 0 };
+        if (before.h) {
+            // Skip the previous glyph and its effect, they are already drawn
+            const uint64_t before_below { before.row(row + 1 - before_dy) };
+            covered = before_here;
+            covered |= texteffect == GFXtextEffect::Outline ? spread(before_above) | spread(before_here) | spread(before_below) : before_above << 1;
+            covered = before_dx >= 0 ? covered << before_dx : covered >> -before_dx;
+            before_above = before_here;
+            before_here = before_below;
+        }
+        const uint64_t effect { (texteffect == GFXtextEffect::Outline ? spread(above) | spread(here) | spread(below) : above << 1) & ~fill & ~covered };
+        const uint64_t back { (row >= 0) && (row < 8) ? cell & ~fill & ~effect & ~covered : 0 };
+
+        // One pass over the row, every run is written once in its color
+        const uint64_t any { fill | effect | back };
+        uint8_t k { 0 };
+        while ((k < 64) && (any >> k)) {
+            if (!((any >> k) & 1)) {
+                k++;
+                continue;
+            }
+            const uint8_t kind { static_cast<uint8_t>((fill >> k) & 1 ? 0 : (effect >> k) & 1 ? 1 : 2) };
+            const uint64_t run { kind == 0 ? fill : kind == 1 ? effect : back };
+            const uint16_t run_color { kind == 0 ? color : kind == 1 ? texteffectcolor : bg };
+            uint8_t end { k };
+            while ((end < 64) && ((run >> end) & 1)) {
+                end++;
+            }
+            const gfx_coord_t px { static_cast<gfx_coord_t>(glyph.xo + k - 1) }, py { static_cast<gfx_coord_t>(glyph.yo + row) };
+            if (size == 1) {
+                writeFastHLine(x + px, y + py, end - k, run_color);
+            } else {
+                writeFillRect(x + px * size, y + py * size, (end - k) * size, size, run_color);
+            }
+            k = end;
+        }
+
+        above = here;
+        here = below;
+    }
+    endWrite();
+    return true;
+}
+
+Adafruit_GFX::GlyphMask Adafruit_GFX::glyphMask(unsigned char c) const {
+    GlyphMask glyph {};
+    if (!gfxFont) {
+        if (!_cp437 && (c >= 176)) {
+            c++; // Handle 'classic' charset behavior
+        }
+        glyph.bitmap = &font[c * 5];
+        glyph.w = 5;
+        glyph.h = 8;
+        glyph.classic = true;
+    } else if ((c >= gfxFont->first) && (c <= gfxFont->last)) {
+        const GFXglyph& g { gfxFont->glyph[c - gfxFont->first] };
+        glyph.bitmap = gfxFont->bitmap + g.bitmapOffset;
+        glyph.w = g.width;
+        glyph.h = g.height;
+        glyph.xo = g.xOffset;
+        glyph.yo = g.yOffset;
+    }
+    return glyph;
+}
+
+uint64_t Adafruit_GFX::GlyphMask::row(int16_t r) const {
+    if ((r < 0) || (r >= h)) {
+        return 0;
+    }
+    uint64_t m { 0 };
+    if (classic) {
+        for (uint8_t i { 0 }; i < 5; i++) {
+            m |= static_cast<uint64_t>((bitmap[i] >> r) & 1) << (i + 1);
+        }
+    } else {
+        uint32_t bit { static_cast<uint32_t>(r) * w };
+        for (uint8_t i { 0 }; i < w; i++, bit++) {
+            m |= static_cast<uint64_t>((bitmap[bit / 8] >> (7 - bit % 8)) & 1) << (i + 1);
+        }
+    }
+    return m;
+}
+
+void Adafruit_GFX::drawTextChar(unsigned char c) {
+    if ((texteffect == GFXtextEffect::None)
+        || !drawCharEffect(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize, texteffectprev, texteffectprevx, texteffectprevy)) {
+        drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
+    }
+    texteffectprev = c;
+    texteffectprevx = cursor_x;
+    texteffectprevy = cursor_y;
+}
+
 size_t Adafruit_GFX::write(uint8_t c) {
     if (!gfxFont) { // 'Classic' built-in font
         if (c == '\n') { // Newline?
@@ -704,13 +1278,13 @@ size_t Adafruit_GFX::write(uint8_t c) {
                 cursor_x = 0; // Reset x to zero,
                 cursor_y += textsize * 8; // advance y one line
             }
-            drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
+            drawTextChar(c);
             cursor_x += textsize * 6; // Advance x one char
         }
     } else { // Custom font
         if (c == '\n') {
             cursor_x = 0;
-            cursor_y += (int16_t) textsize * gfxFont->yAdvance;
+            cursor_y += (gfx_coord_t) textsize * gfxFont->yAdvance;
         } else if (c != '\r') {
             const uint8_t first { gfxFont->first };
             if ((c >= first) && (c <= gfxFont->last)) {
@@ -718,14 +1292,14 @@ size_t Adafruit_GFX::write(uint8_t c) {
                 uint8_t w { glyph->width };
                 uint8_t h { glyph->height };
                 if ((w > 0) && (h > 0)) { // Is there an associated bitmap?
-                    int16_t xo = glyph->xOffset; // sic
+                    gfx_coord_t xo = glyph->xOffset; // sic
                     if (wrap && ((cursor_x + textsize * (xo + w)) > _width)) {
                         cursor_x = 0;
-                        cursor_y += (int16_t) textsize * gfxFont->yAdvance;
+                        cursor_y += (gfx_coord_t) textsize * gfxFont->yAdvance;
                     }
-                    drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
+                    drawTextChar(c);
                 }
-                cursor_x += glyph->xAdvance * (int16_t) textsize;
+                cursor_x += glyph->xAdvance * (gfx_coord_t) textsize;
             }
         }
     }
@@ -763,9 +1337,10 @@ void Adafruit_GFX::setFont(const GFXfont* f) {
         cursor_y -= 6;
     }
     gfxFont = (GFXfont*) f;
+    texteffectprev = -1;
 }
 
-void Adafruit_GFX::charBounds(char c, int16_t* x, int16_t* y, int16_t* minx, int16_t* miny, int16_t* maxx, int16_t* maxy) {
+void Adafruit_GFX::charBounds(char c, gfx_coord_t* x, gfx_coord_t* y, gfx_coord_t* minx, gfx_coord_t* miny, gfx_coord_t* maxx, gfx_coord_t* maxy) {
     if (gfxFont) {
         if (c == '\n') { // Newline?
             *x = 0; // Reset x to zero, advance y by one line
@@ -780,15 +1355,15 @@ void Adafruit_GFX::charBounds(char c, int16_t* x, int16_t* y, int16_t* minx, int
                 uint8_t xa { glyph->xAdvance };
                 int8_t xo { glyph->xOffset };
                 int8_t yo { glyph->yOffset };
-                if (wrap && ((*x + (((int16_t) xo + gw) * textsize)) > _width)) {
+                if (wrap && ((*x + (((gfx_coord_t) xo + gw) * textsize)) > _width)) {
                     *x = 0; // Reset x to zero, advance y by one line
                     *y += textsize * (uint8_t) pgm_read_byte(&gfxFont->yAdvance);
                 }
-                int16_t ts { textsize };
-                int16_t x1 { static_cast<int16_t>(*x + xo * ts) };
-                int16_t y1 { static_cast<int16_t>(*y + yo * ts) };
-                int16_t x2 { static_cast<int16_t>(x1 + gw * ts - 1) };
-                int16_t y2 { static_cast<int16_t>(y1 + gh * ts - 1) };
+                gfx_coord_t ts { textsize };
+                gfx_coord_t x1 { static_cast<gfx_coord_t>(*x + xo * ts) };
+                gfx_coord_t y1 { static_cast<gfx_coord_t>(*y + yo * ts) };
+                gfx_coord_t x2 { static_cast<gfx_coord_t>(x1 + gw * ts - 1) };
+                gfx_coord_t y2 { static_cast<gfx_coord_t>(y1 + gh * ts - 1) };
                 if (x1 < *minx)
                     *minx = x1;
                 if (y1 < *miny)
@@ -829,15 +1404,16 @@ void Adafruit_GFX::charBounds(char c, int16_t* x, int16_t* y, int16_t* minx, int
     }
 }
 
-void Adafruit_GFX::getTextBounds(const char* str, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+void Adafruit_GFX::getTextBounds(const char* str, gfx_coord_t x, gfx_coord_t y, gfx_coord_t* x1, gfx_coord_t* y1, gfx_ucoord_t* w, gfx_ucoord_t* h) {
+    GFX_PROFILE_FUNCTION();
     *x1 = x;
     *y1 = y;
     *w = *h = 0;
 
-    int16_t minx { _width };
-    int16_t miny { _height };
-    int16_t maxx { -1 };
-    int16_t maxy { -1 };
+    gfx_coord_t minx { _width };
+    gfx_coord_t miny { _height };
+    gfx_coord_t maxx { -1 };
+    gfx_coord_t maxy { -1 };
 
     uint8_t c;
     while ((c = *str++)) {
@@ -854,15 +1430,16 @@ void Adafruit_GFX::getTextBounds(const char* str, int16_t x, int16_t y, int16_t*
     }
 }
 
-void Adafruit_GFX::getTextBounds(const String& str, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+void Adafruit_GFX::getTextBounds(const String& str, gfx_coord_t x, gfx_coord_t y, gfx_coord_t* x1, gfx_coord_t* y1, gfx_ucoord_t* w, gfx_ucoord_t* h) {
+    GFX_PROFILE_FUNCTION();
     if (str.length() != 0) {
         getTextBounds(const_cast<char*>(str.c_str()), x, y, x1, y1, w, h);
     }
 }
 
 
-void Adafruit_GFX_Button::initButtonUL(
-    Adafruit_GFX* gfx, int16_t x1, int16_t y1, uint16_t w, uint16_t h, uint16_t outline, uint16_t fill, uint16_t textcolor, char* label, uint8_t textsize) {
+void Adafruit_GFX_Button::initButtonUL(Adafruit_GFX* gfx, gfx_coord_t x1, gfx_coord_t y1, gfx_ucoord_t w, gfx_ucoord_t h, uint16_t outline, uint16_t fill,
+    uint16_t textcolor, char* label, uint8_t textsize) {
     _x1 = x1;
     _y1 = y1;
     _w = w;
@@ -876,6 +1453,7 @@ void Adafruit_GFX_Button::initButtonUL(
 }
 
 void Adafruit_GFX_Button::drawButton(bool inverted) {
+    GFX_PROFILE_FUNCTION();
     uint16_t fill, outline, text;
 
     if (!inverted) {
@@ -898,8 +1476,8 @@ void Adafruit_GFX_Button::drawButton(bool inverted) {
     _gfx->print(_label);
 }
 
-bool Adafruit_GFX_Button::contains(int16_t x, int16_t y) const {
-    return ((x >= _x1) && (x < static_cast<int16_t>(_x1 + _w)) && (y >= _y1) && (y < static_cast<int16_t>(_y1 + _h)));
+bool Adafruit_GFX_Button::contains(gfx_coord_t x, gfx_coord_t y) const {
+    return ((x >= _x1) && (x < static_cast<gfx_coord_t>(_x1 + _w)) && (y >= _y1) && (y < static_cast<gfx_coord_t>(_y1 + _h)));
 }
 
 void Adafruit_GFX_Button::press(bool p) {
@@ -925,8 +1503,8 @@ void Adafruit_GFX_Button::press(bool p) {
 // scanline pad).
 // NOT EXTENSIVELY TESTED YET.  MAY CONTAIN WORST BUGS KNOWN TO HUMANKIND.
 
-GFXcanvas1::GFXcanvas1(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) {
-    const size_t bytes { static_cast<size_t>(((w + 7) / 8) * h) };
+GFXcanvas1::GFXcanvas1(gfx_ucoord_t w, gfx_ucoord_t h) : Adafruit_GFX(w, h) {
+    const size_t bytes { static_cast<size_t>((w + 7) / 8) * h };
     buffer = new uint8_t[bytes];
 
     if (buffer) {
@@ -940,7 +1518,7 @@ GFXcanvas1::~GFXcanvas1() {
     }
 }
 
-void GFXcanvas1::drawPixel(int16_t x, int16_t y, uint16_t color) {
+void GFXcanvas1::drawPixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) {
     if (!buffer) {
         return;
     }
@@ -949,7 +1527,7 @@ void GFXcanvas1::drawPixel(int16_t x, int16_t y, uint16_t color) {
         return;
     }
 
-    int16_t t;
+    gfx_coord_t t;
     switch (rotation) {
         case 1:
             t = x;
@@ -967,7 +1545,7 @@ void GFXcanvas1::drawPixel(int16_t x, int16_t y, uint16_t color) {
             break;
     }
 
-    uint8_t* ptr { &buffer[(x / 8) + y * ((WIDTH + 7) / 8)] };
+    uint8_t* ptr { &buffer[(x / 8) + static_cast<size_t>(y) * ((WIDTH + 7) / 8)] };
     if (color) {
         *ptr |= 0x80 >> (x & 7);
     } else {
@@ -975,18 +1553,49 @@ void GFXcanvas1::drawPixel(int16_t x, int16_t y, uint16_t color) {
     }
 }
 
+bool GFXcanvas1::getPixel(gfx_coord_t x, gfx_coord_t y) const {
+    if (!buffer) {
+        return false;
+    }
+
+    if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) {
+        return false;
+    }
+
+    gfx_coord_t t;
+    switch (rotation) {
+        case 1:
+            t = x;
+            x = WIDTH - 1 - y;
+            y = t;
+            break;
+        case 2:
+            x = WIDTH - 1 - x;
+            y = HEIGHT - 1 - y;
+            break;
+        case 3:
+            t = x;
+            x = y;
+            y = HEIGHT - 1 - t;
+            break;
+    }
+
+    return buffer[(x / 8) + static_cast<size_t>(y) * ((WIDTH + 7) / 8)] & (0x80 >> (x & 7));
+}
+
 void GFXcanvas1::fillScreen(uint16_t color) {
+    GFX_PROFILE_FUNCTION();
     if (!buffer) {
         return;
     }
 
-    const size_t bytes { static_cast<size_t>(((WIDTH + 7) / 8) * HEIGHT) };
+    const size_t bytes { static_cast<size_t>((WIDTH + 7) / 8) * HEIGHT };
     std::memset(buffer, color ? 0xFF : 0x00, bytes);
 }
 
 
-GFXcanvas8::GFXcanvas8(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) {
-    const size_t bytes { static_cast<size_t>(w * h) };
+GFXcanvas8::GFXcanvas8(gfx_ucoord_t w, gfx_ucoord_t h) : Adafruit_GFX(w, h) {
+    const size_t bytes { static_cast<size_t>(w) * h };
     buffer = new uint8_t[bytes];
 
     if (buffer) {
@@ -1000,7 +1609,7 @@ GFXcanvas8::~GFXcanvas8() {
     }
 }
 
-void GFXcanvas8::drawPixel(int16_t x, int16_t y, uint16_t color) {
+void GFXcanvas8::drawPixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) {
     if (!buffer) {
         return;
     }
@@ -1008,7 +1617,7 @@ void GFXcanvas8::drawPixel(int16_t x, int16_t y, uint16_t color) {
     if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height))
         return;
 
-    int16_t t;
+    gfx_coord_t t;
     switch (rotation) {
         case 1:
             t = x;
@@ -1026,42 +1635,87 @@ void GFXcanvas8::drawPixel(int16_t x, int16_t y, uint16_t color) {
             break;
     }
 
-    buffer[x + y * WIDTH] = color;
+    buffer[x + static_cast<size_t>(y) * WIDTH] = color;
 }
 
 void GFXcanvas8::fillScreen(uint16_t color) {
+    GFX_PROFILE_FUNCTION();
     if (!buffer) {
         return;
     }
 
-    std::memset(buffer, color, WIDTH * HEIGHT);
+    std::memset(buffer, color, static_cast<size_t>(WIDTH) * HEIGHT);
 }
 
-void GFXcanvas8::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
-    if (!buffer) {
+void GFXcanvas8::writeFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) {
+    if (w <= 0) {
+        // Keep the generic behaviour for degenerate sizes
+        Adafruit_GFX::writeFastHLine(x, y, w, color);
+        return;
+    }
+    if (!buffer || (y < 0) || (y >= _height)) {
         return;
     }
 
-    if ((x >= _width) || (y < 0) || (y >= _height)) {
+    // Clip left/right
+    const gfx_coord_t x2 { static_cast<gfx_coord_t>(std::min<int32_t>(x + w, _width)) };
+    x = std::max<gfx_coord_t>(x, 0);
+    if (x >= x2) {
         return;
     }
+    w = x2 - x;
+
+    // A logical row is a buffer row for rotation 0 and 2, and a buffer column for rotation 1 and 3
+    switch (rotation) {
+        case 0: std::memset(buffer + static_cast<size_t>(y) * WIDTH + x, color, w); break;
+
+        case 2: std::memset(buffer + static_cast<size_t>(HEIGHT - 1 - y) * WIDTH + (WIDTH - x - w), color, w); break;
+
+        case 1: {
+            uint8_t* p { buffer + static_cast<size_t>(x) * WIDTH + (WIDTH - 1 - y) };
+            for (; w > 0; w--, p += WIDTH) {
+                *p = color;
+            }
+            break;
+        }
+
+        case 3: {
+            uint8_t* p { buffer + static_cast<size_t>(HEIGHT - x - w) * WIDTH + y };
+            for (; w > 0; w--, p += WIDTH) {
+                *p = color;
+            }
+            break;
+        }
+    }
+}
 
-    const int16_t x2 { static_cast<int16_t>(x + w - 1) };
-    if (x2 < 0) {
+void GFXcanvas8::writeFastHLineAlpha(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color, uint8_t alpha) {
+    if (alpha == 255) {
+        writeFastHLine(x, y, w, color);
+        return;
+    }
+    if (!alpha || (y < 0) || (y >= _height)) {
         return;
     }
 
-    // Clip left/right
-    if (x < 0) {
-        x = 0;
-        w = x2 + 1;
+    const gfx_coord_t x2 { static_cast<gfx_coord_t>(std::min<int32_t>(x + w, _width)) };
+    const gfx_coord_t fg { static_cast<gfx_coord_t>(color & 0xff) };
+    for (x = std::max<gfx_coord_t>(x, 0); x < x2; x++) {
+        const gfx_coord_t bg { getPixel(x, y) };
+        drawPixel(x, y, bg + ((fg - bg) * alpha + 127) / 255);
+    }
+}
+
+uint8_t GFXcanvas8::getPixel(gfx_coord_t x, gfx_coord_t y) const {
+    if (!buffer) {
+        return 0;
     }
 
-    if (x2 >= _width) {
-        w = _width - x;
+    if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) {
+        return 0;
     }
 
-    int16_t t;
+    gfx_coord_t t;
     switch (rotation) {
         case 1:
             t = x;
@@ -1079,12 +1733,12 @@ void GFXcanvas8::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
             break;
     }
 
-    std::memset(buffer + y * WIDTH + x, color, w);
+    return buffer[x + static_cast<size_t>(y) * WIDTH];
 }
 
 
-GFXcanvas16::GFXcanvas16(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) {
-    const size_t bytes { static_cast<size_t>(w * h * 2) };
+GFXcanvas16::GFXcanvas16(gfx_ucoord_t w, gfx_ucoord_t h, bool big_endian) : Adafruit_GFX(w, h), big_endian { big_endian } {
+    const size_t bytes { static_cast<size_t>(w) * h * 2 };
     buffer = new uint16_t[bytes / 2];
 
     if (buffer) {
@@ -1098,7 +1752,7 @@ GFXcanvas16::~GFXcanvas16() {
     }
 }
 
-void GFXcanvas16::drawPixel(int16_t x, int16_t y, uint16_t color) {
+void GFXcanvas16::drawPixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) {
     if (!buffer) {
         return;
     }
@@ -1107,7 +1761,7 @@ void GFXcanvas16::drawPixel(int16_t x, int16_t y, uint16_t color) {
         return;
     }
 
-    int16_t t;
+    gfx_coord_t t;
     switch (rotation) {
         case 1:
             t = x;
@@ -1125,22 +1779,190 @@ void GFXcanvas16::drawPixel(int16_t x, int16_t y, uint16_t color) {
             break;
     }
 
-    buffer[x + y * WIDTH] = color;
+    buffer[x + static_cast<size_t>(y) * WIDTH] = stored(color);
 }
 
 void GFXcanvas16::fillScreen(uint16_t color) {
+    GFX_PROFILE_FUNCTION();
     if (!buffer) {
         return;
     }
 
+    color = stored(color);
     const uint8_t hi { static_cast<uint8_t>(color >> 8) };
     const uint8_t lo { static_cast<uint8_t>(color & 0xff) };
     if (hi == lo) {
-        std::memset(buffer, lo, WIDTH * HEIGHT * 2);
+        std::memset(buffer, lo, static_cast<size_t>(WIDTH) * HEIGHT * 2);
     } else {
-        const uint32_t pixels { static_cast<uint32_t>(WIDTH * HEIGHT) };
-        for (uint32_t i { 0 }; i < pixels; i++) {
+        const size_t pixels { static_cast<size_t>(WIDTH) * HEIGHT };
+        for (size_t i { 0 }; i < pixels; i++) {
             buffer[i] = color;
         }
     }
 }
+
+void GFXcanvas16::writeFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) {
+    if (w <= 0) {
+        // Keep the generic behaviour for degenerate sizes
+        Adafruit_GFX::writeFastHLine(x, y, w, color);
+        return;
+    }
+
+    ptrdiff_t step;
+    uint16_t* p { row(x, y, w, step) };
+    if (!p) {
+        return;
+    }
+    color = stored(color);
+    if (step == 1) {
+        std::fill_n(p, w, color);
+    } else if (step == -1) {
+        std::fill_n(p - (w - 1), w, color);
+    } else {
+        for (; w > 0; w--, p += step) {
+            *p = color;
+        }
+    }
+}
+
+void GFXcanvas16::fillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) {
+    GFX_PROFILE_FUNCTION();
+    if ((w <= 0) || (h <= 0)) {
+        Adafruit_GFX::fillRect(x, y, w, h, color);
+        return;
+    }
+
+    const gfx_coord_t y2 { static_cast<gfx_coord_t>(std::min<int32_t>(y + h, _height)) };
+    for (y = std::max<gfx_coord_t>(y, 0); y < y2; y++) {
+        writeFastHLine(x, y, w, color);
+    }
+}
+
+void GFXcanvas16::writeFastHLineAlpha(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color, uint8_t alpha) {
+    if (alpha == 255) {
+        writeFastHLine(x, y, w, color);
+        return;
+    }
+    if (!alpha || (y < 0) || (y >= _height)) {
+        return;
+    }
+
+    const gfx_coord_t x2 { static_cast<gfx_coord_t>(std::min<int32_t>(x + w, _width)) };
+    for (x = std::max<gfx_coord_t>(x, 0); x < x2; x++) {
+        drawPixel(x, y, blend565(color, getPixel(x, y), alpha));
+    }
+}
+
+uint16_t* GFXcanvas16::row(gfx_coord_t& x, gfx_coord_t y, gfx_coord_t& w, ptrdiff_t& step) const {
+    if (!buffer || (y < 0) || (y >= _height)) {
+        return nullptr;
+    }
+
+    // Clip left/right
+    const gfx_coord_t x2 { static_cast<gfx_coord_t>(std::min<int32_t>(x + w, _width)) };
+    const gfx_coord_t x1 { std::max<gfx_coord_t>(x, 0) };
+    if (x1 >= x2) {
+        return nullptr;
+    }
+    w = x2 - x1;
+    x = x1;
+
+    // A logical row is a buffer row for rotation 0 and 2, and a buffer column for rotation 1 and 3
+    switch (rotation) {
+        case 1:
+            step = WIDTH;
+            return buffer + static_cast<size_t>(x) * WIDTH + (WIDTH - 1 - y);
+        case 2:
+            step = -1;
+            return buffer + static_cast<size_t>(HEIGHT - 1 - y) * WIDTH + (WIDTH - 1 - x);
+        case 3:
+            step = -static_cast<ptrdiff_t>(WIDTH);
+            return buffer + static_cast<size_t>(HEIGHT - 1 - x) * WIDTH + y;
+        default:
+            step = 1;
+            return buffer + static_cast<size_t>(y) * WIDTH + x;
+    }
+}
+
+void GFXcanvas16::writeRGBSpan(gfx_coord_t x, gfx_coord_t y, const uint16_t colors[], gfx_coord_t w) {
+    const gfx_coord_t x0 { x };
+    ptrdiff_t step;
+    uint16_t* p { row(x, y, w, step) };
+    if (!p) {
+        return;
+    }
+    colors += x - x0;
+    if (big_endian) {
+        for (; w > 0; w--, p += step) {
+            *p = swapBytes(*colors++);
+        }
+    } else {
+        for (; w > 0; w--, p += step) {
+            *p = *colors++;
+        }
+    }
+}
+
+bool GFXcanvas16::readRGBSpan(gfx_coord_t x, gfx_coord_t y, uint16_t colors[], gfx_coord_t w) {
+    if (!buffer) {
+        return false;
+    }
+    for (gfx_coord_t i { 0 }; i < w; i++) {
+        colors[i] = 0;
+    }
+
+    const gfx_coord_t x0 { x };
+    ptrdiff_t step;
+    const uint16_t* p { row(x, y, w, step) };
+    if (p) {
+        for (colors += x - x0; w > 0; w--, p += step) {
+            *colors++ = stored(*p);
+        }
+    }
+    return true;
+}
+
+void GFXcanvas16::drawRGBBitmap(gfx_coord_t x, gfx_coord_t y, uint16_t* bitmap, gfx_coord_t w, gfx_coord_t h) {
+    GFX_PROFILE_FUNCTION();
+    for (gfx_coord_t j { 0 }; j < h; j++) {
+        gfx_coord_t x1 { x }, w1 { w };
+        ptrdiff_t step;
+        uint16_t* p { row(x1, y + j, w1, step) };
+        if (!p) {
+            continue;
+        }
+        for (const uint16_t* c { bitmap + static_cast<size_t>(j) * w + (x1 - x) }; w1 > 0; w1--, p += step) {
+            *p = stored(*c++);
+        }
+    }
+}
+
+uint16_t GFXcanvas16::getPixel(gfx_coord_t x, gfx_coord_t y) const {
+    if (!buffer) {
+        return 0;
+    }
+
+    if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) {
+        return 0;
+    }
+
+    gfx_coord_t t;
+    switch (rotation) {
+        case 1:
+            t = x;
+            x = WIDTH - 1 - y;
+            y = t;
+            break;
+        case 2:
+            x = WIDTH - 1 - x;
+            y = HEIGHT - 1 - y;
+            break;
+        case 3:
+            t = x;
+            x = y;
+            y = HEIGHT - 1 - t;
+            break;
+    }
+
+    return stored(buffer[x + static_cast<size_t>(y) * WIDTH]);
+}
@@ -38,6 +38,38 @@
 #include "Arduino.h"
 #include "Print.h"
 #include "gfxfont.h"
+#include "gfxatlas.h"
+#include "gfxindexed.h"
+#include "gfxninepatch.h"
+
+
+#ifdef ADAFRUIT_GFX_COORD32
+// Host builds rendering canvases beyond 32767 pixels on a side: define ADAFRUIT_GFX_COORD32 for the library and all code using it.
+// Curves and paths use 24.8 fixed point internally and stay limited to +/- 8 million pixels.
+using gfx_coord_t = int32_t; ///< Pixel coordinate or signed size
+using gfx_ucoord_t = uint32_t; ///< Unsigned size in pixels
+#define GFX_COORD_MIN INT32_MIN ///< Smallest gfx_coord_t value
+#define GFX_COORD_MAX INT32_MAX ///< Largest gfx_coord_t value
+#else
+using gfx_coord_t = int16_t; ///< Pixel coordinate or signed size
+using gfx_ucoord_t = uint16_t; ///< Unsigned size in pixels
+#define GFX_COORD_MIN INT16_MIN ///< Smallest gfx_coord_t value
+#define GFX_COORD_MAX INT16_MAX ///< Largest gfx_coord_t value
+#endif
+
+/// Horizontal run of pixels, relative to an origin
+struct GFXspan {
+    gfx_coord_t x; ///< Left-most x offset
+    gfx_coord_t y; ///< y offset
+    gfx_coord_t w; ///< Width in pixels
+};
+
+/// Decoration drawn around text glyphs, see Adafruit_GFX::setTextEffect()
+enum class GFXtextEffect : uint8_t {
+    None, ///< Plain glyphs
+    Outline, ///< One pixel outline around the glyph, including the diagonals
+    Shadow, ///< Drop shadow offset by one pixel to the right and down
+};
 
 /// A generic graphics superclass that can handle all sorts of drawing. At a minimum you can subclass and provide drawPixel(). At a maximum you can do a ton of
 /// overriding to optimize.
@@ -48,13 +80,13 @@ public:
        @param    w   Display width, in pixels
        @param    h   Display height, in pixels
     */
-    Adafruit_GFX(int16_t w, int16_t h);
+    Adafruit_GFX(gfx_coord_t w, gfx_coord_t h);
 
     virtual ~Adafruit_GFX() = default;
 
-    virtual void drawPixel(
-        int16_t x, int16_t y, uint16_t color) = 0; ///< Virtual drawPixel() function to draw to the screen/framebuffer/etc, must be overridden in subclass.
-                                                   ///< @param x X coordinate.  @param y Y coordinate. @param color 16-bit pixel color.
+    virtual void drawPixel(gfx_coord_t x, gfx_coord_t y,
+        uint16_t color) = 0; ///< Virtual drawPixel() function to draw to the screen/framebuffer/etc, must be overridden in subclass.
+                             ///< @param x X coordinate.  @param y Y coordinate. @param color 16-bit pixel color.
 
     /*!
        @brief    Start a display-writing routine, overwrite in subclasses.
@@ -67,7 +99,7 @@ public:
         @param   y   y coordinate
         @param   color 16-bit 5-6-5 Color to fill with
     */
-    virtual void writePixel(int16_t x, int16_t y, uint16_t color) {
+    virtual void writePixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) {
         drawPixel(x, y, color);
     }
 
@@ -79,7 +111,7 @@ public:
         @param    h   Height in pixels
         @param    color 16-bit 5-6-5 Color to fill with
     */
-    virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    virtual void writeFillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) {
         fillRect(x, y, w, h, color);
     }
 
@@ -90,7 +122,7 @@ public:
         @param    h   Height in pixels
         @param    color 16-bit 5-6-5 Color to fill with
     */
-    virtual void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    virtual void writeFastVLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t h, uint16_t color) {
         drawFastVLine(x, y, h, color);
     }
 
@@ -101,10 +133,52 @@ public:
         @param    w   Width in pixels
         @param    color 16-bit 5-6-5 Color to fill with
     */
-    virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    virtual void writeFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) {
         drawFastHLine(x, y, w, color);
     }
 
+    /*!
+        @brief    Write a horizontal line with partial coverage, used by anti-aliased primitives. Targets that can read back
+                  their pixels override this to blend, the default writes the line only if alpha is at least 50%.
+        @param    x   Left-most x coordinate
+        @param    y   Left-most y coordinate
+        @param    w   Width in pixels
+        @param    color 16-bit 5-6-5 Color to blend with
+        @param    alpha  Coverage, 0 = transparent, 255 = opaque
+    */
+    virtual void writeFastHLineAlpha(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color, uint8_t alpha) {
+        if (alpha >= 128) {
+            writeFastHLine(x, y, w, color);
+        }
+    }
+
+    /*!
+        @brief    Write a row of pixels, overwrite in subclasses if startWrite is defined! colors is read as plain memory,
+                  callers holding PROGMEM-resident data copy it into a RAM buffer first.
+        @param    x   Left-most x coordinate
+        @param    y   y coordinate
+        @param    colors  w 16-bit 5-6-5 colors in RAM (or memory-mapped flash)
+        @param    w   Width in pixels
+    */
+    virtual void writeRGBSpan(gfx_coord_t x, gfx_coord_t y, const uint16_t colors[], gfx_coord_t w);
+
+    /*!
+        @brief    Read back a row of pixels, e.g. for GFXsaveUnder. Targets that keep their pixels in memory, or
+                  panels that can read their memory, override this.
+        @param    x   Left-most x coordinate
+        @param    y   y coordinate
+        @param    colors  Receives w 16-bit 5-6-5 colors, pixels outside of the target read as 0
+        @param    w   Width in pixels
+        @returns  False if the target can't read back pixels, colors is unchanged then
+    */
+    virtual bool readRGBSpan(gfx_coord_t x, gfx_coord_t y, uint16_t colors[], gfx_coord_t w) {
+        static_cast<void>(x);
+        static_cast<void>(y);
+        static_cast<void>(colors);
+        static_cast<void>(w);
+        return false;
+    }
+
     /*!
         @brief    Write a line.  Bresenham's algorithm - thx wikpedia
         @param    x0  Start point x coordinate
@@ -113,7 +187,7 @@ public:
         @param    y1  End point y coordinate
         @param    color 16-bit 5-6-5 Color to draw with
     */
-    virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+    virtual void writeLine(gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t x1, gfx_coord_t y1, uint16_t color);
 
     /*!
         @brief    End a display-writing routine, overwrite in subclasses if startWrite is defined!
@@ -141,7 +215,7 @@ public:
         @param    h   Height in pixels
         @param    color 16-bit 5-6-5 Color to fill with
     */
-    virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    virtual void drawFastVLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t h, uint16_t color);
 
     /*!
         @brief    Draw a perfectly horizontal line (this is often optimized in a subclass!)
@@ -150,7 +224,7 @@ public:
         @param    w   Width in pixels
         @param    color 16-bit 5-6-5 Color to fill with
     */
-    virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    virtual void drawFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color);
 
     /*!
         @brief    Fill a rectangle completely with one color. Update in subclasses if desired!
@@ -160,7 +234,7 @@ public:
         @param    h   Height in pixels
         @param    color 16-bit 5-6-5 Color to fill with
     */
-    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    virtual void fillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color);
 
     /*!
         @brief    Fill the screen completely with one color. Update in subclasses if desired!
@@ -178,7 +252,7 @@ public:
         @param    y1  End point y coordinate
         @param    color 16-bit 5-6-5 Color to draw with
     */
-    virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+    virtual void drawLine(gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t x1, gfx_coord_t y1, uint16_t color);
 
     /*!
         @brief    Draw a rectangle with no fill color
@@ -188,7 +262,7 @@ public:
         @param    h   Height in pixels
         @param    color 16-bit 5-6-5 Color to draw with
     */
-    virtual void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    virtual void drawRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color);
 
     /*!
         @brief    Draw a circle outline
@@ -197,7 +271,7 @@ public:
         @param    r   Radius of circle
         @param    color 16-bit 5-6-5 Color to draw with
     */
-    void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+    void drawCircle(gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t r, uint16_t color);
 
     /*!
         @brief    Quarter-circle drawer, used to do circles and roundrects
@@ -207,7 +281,7 @@ public:
         @param    cornername  Mask bit #1 or bit #2 to indicate which quarters of the circle we're doing
         @param    color 16-bit 5-6-5 Color to draw with
     */
-    void drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, uint16_t color);
+    void drawCircleHelper(gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t r, uint8_t cornername, uint16_t color);
 
     /*!
         @brief    Draw a circle with filled color
@@ -216,7 +290,7 @@ public:
         @param    r   Radius of circle
         @param    color 16-bit 5-6-5 Color to fill with
     */
-    void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+    void fillCircle(gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t r, uint16_t color);
 
     /*!
         @brief  Quarter-circle drawer with fill, used for circles and roundrects
@@ -227,7 +301,7 @@ public:
         @param  delta    Offset from center-point, used for round-rects
         @param  color    16-bit 5-6-5 Color to fill with
     */
-    void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, int16_t delta, uint16_t color);
+    void fillCircleHelper(gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t r, uint8_t cornername, gfx_coord_t delta, uint16_t color);
 
     /*!
         @brief    Draw a triangle with no fill color
@@ -239,7 +313,7 @@ public:
         @param    y2  Vertex #2 y coordinate
         @param    color 16-bit 5-6-5 Color to draw with
     */
-    void drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+    void drawTriangle(gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t x1, gfx_coord_t y1, gfx_coord_t x2, gfx_coord_t y2, uint16_t color);
 
     /*!
         @brief    Draw a triangle with color-fill
@@ -251,7 +325,7 @@ public:
         @param    y2  Vertex #2 y coordinate
         @param    color 16-bit 5-6-5 Color to fill/draw with
     */
-    void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+    void fillTriangle(gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t x1, gfx_coord_t y1, gfx_coord_t x2, gfx_coord_t y2, uint16_t color);
 
     /*!
         @brief    Draw a rounded rectangle with no fill color
@@ -262,7 +336,7 @@ public:
         @param    r   Radius of corner rounding
         @param    color 16-bit 5-6-5 Color to draw with
     */
-    void drawRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h, int16_t radius, uint16_t color);
+    void drawRoundRect(gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t w, gfx_coord_t h, gfx_coord_t radius, uint16_t color);
 
     /*!
         @brief    Draw a rounded rectangle with fill color
@@ -273,7 +347,54 @@ public:
         @param    r   Radius of corner rounding
         @param    color 16-bit 5-6-5 Color to draw/fill with
     */
-    void fillRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h, int16_t radius, uint16_t color);
+    void fillRoundRect(gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t w, gfx_coord_t h, gfx_coord_t radius, uint16_t color);
+
+    /*!
+        @brief    Draw a quadratic Bezier curve. The curve is split into flat segments by adaptive forward
+                  differencing (fixed point, no floating point) and the segments are written as spans.
+        @param    x0  Start point x coordinate
+        @param    y0  Start point y coordinate
+        @param    x1  Control point x coordinate
+        @param    y1  Control point y coordinate
+        @param    x2  End point x coordinate
+        @param    y2  End point y coordinate
+        @param    color 16-bit 5-6-5 Color to draw with
+    */
+    void drawQuadBezier(gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t x1, gfx_coord_t y1, gfx_coord_t x2, gfx_coord_t y2, uint16_t color);
+
+    /*!
+        @brief    Draw a cubic Bezier curve. The curve is split into flat segments by adaptive forward
+                  differencing (fixed point, no floating point) and the segments are written as spans.
+        @param    x0  Start point x coordinate
+        @param    y0  Start point y coordinate
+        @param    x1  First control point x coordinate
+        @param    y1  First control point y coordinate
+        @param    x2  Second control point x coordinate
+        @param    y2  Second control point y coordinate
+        @param    x3  End point x coordinate
+        @param    y3  End point y coordinate
+        @param    color 16-bit 5-6-5 Color to draw with
+    */
+    void drawCubicBezier(
+        gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t x1, gfx_coord_t y1, gfx_coord_t x2, gfx_coord_t y2, gfx_coord_t x3, gfx_coord_t y3, uint16_t color);
+
+    /*!
+        @brief    Draw a spline of quadratic Bezier segments, each segment starts at the end point of the previous one.
+                  Shared end points are written only once.
+        @param    points  Interleaved x/y coordinates: start point, then control point and end point of each segment
+        @param    count   Number of points (not coordinates) in the array, 2 * segments + 1
+        @param    color 16-bit 5-6-5 Color to draw with
+    */
+    void drawQuadSpline(const gfx_coord_t points[], uint16_t count, uint16_t color);
+
+    /*!
+        @brief    Draw a spline of cubic Bezier segments, each segment starts at the end point of the previous one.
+                  Shared end points are written only once.
+        @param    points  Interleaved x/y coordinates: start point, then two control points and the end point of each segment
+        @param    count   Number of points (not coordinates) in the array, 3 * segments + 1
+        @param    color 16-bit 5-6-5 Color to draw with
+    */
+    void drawCubicSpline(const gfx_coord_t points[], uint16_t count, uint16_t color);
 
     /*!
         @brief    Draw a 1-bit image at the specified (x,y) position, using the specified foreground color (unset bits are transparent).
@@ -284,7 +405,7 @@ public:
         @param    h   Hieght of bitmap in pixels
         @param    color 16-bit 5-6-5 Color to draw with
     */
-    void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color);
+    void drawBitmap(gfx_coord_t x, gfx_coord_t y, const uint8_t bitmap[], gfx_coord_t w, gfx_coord_t h, uint16_t color);
 
     /*!
         @brief    Draw a 1-bit image at the specified (x,y) position, using the specified foreground (for set bits) and background (unset bits) colors.
@@ -296,7 +417,7 @@ public:
         @param    color 16-bit 5-6-5 Color to draw pixels with
         @param    bg 16-bit 5-6-5 Color to draw background with
     */
-    void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg);
+    void drawBitmap(gfx_coord_t x, gfx_coord_t y, const uint8_t bitmap[], gfx_coord_t w, gfx_coord_t h, uint16_t color, uint16_t bg);
 
     /*!
         @brief    Draw a RAM-resident 1-bit image at the specified (x,y) position, using the specified foreground color (unset bits are transparent).
@@ -307,7 +428,7 @@ public:
         @param    h   Hieght of bitmap in pixels
         @param    color 16-bit 5-6-5 Color to draw with
     */
-    void drawBitmap(int16_t x, int16_t y, uint8_t* bitmap, int16_t w, int16_t h, uint16_t color);
+    void drawBitmap(gfx_coord_t x, gfx_coord_t y, uint8_t* bitmap, gfx_coord_t w, gfx_coord_t h, uint16_t color);
 
     /*!
         @brief    Draw a 1-bit image at the specified (x,y) position, using the specified foreground (for set bits) and background (unset bits) colors.
@@ -319,7 +440,7 @@ public:
         @param    color 16-bit 5-6-5 Color to draw pixels with
         @param    bg 16-bit 5-6-5 Color to draw background with
     */
-    void drawBitmap(int16_t x, int16_t y, uint8_t* bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg);
+    void drawBitmap(gfx_coord_t x, gfx_coord_t y, uint8_t* bitmap, gfx_coord_t w, gfx_coord_t h, uint16_t color, uint16_t bg);
 
     /*!
         @brief    Draw PXBitMap Files (*.xbm), exported from GIMP. Usage: Export from GIMP to *.xbm, rename *.xbm to *.c and open in editor.
@@ -332,7 +453,7 @@ public:
         @param    h   Hieght of bitmap in pixels
         @param    color 16-bit 5-6-5 Color to draw pixels with
     */
-    void drawXBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color);
+    void drawXBitmap(gfx_coord_t x, gfx_coord_t y, const uint8_t bitmap[], gfx_coord_t w, gfx_coord_t h, uint16_t color);
 
     /*!
         @brief    Draw a 8-bit image (grayscale) at the specified (x,y) pos.
@@ -343,7 +464,7 @@ public:
         @param    w   Width of bitmap in pixels
         @param    h   Hieght of bitmap in pixels
     */
-    void drawGrayscaleBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h);
+    void drawGrayscaleBitmap(gfx_coord_t x, gfx_coord_t y, const uint8_t bitmap[], gfx_coord_t w, gfx_coord_t h);
 
     /*!
         @brief    Draw a RAM-resident 8-bit image (grayscale) at the specified (x,y) pos.
@@ -354,7 +475,7 @@ public:
         @param    w   Width of bitmap in pixels
         @param    h   Hieght of bitmap in pixels
     */
-    void drawGrayscaleBitmap(int16_t x, int16_t y, uint8_t* bitmap, int16_t w, int16_t h);
+    void drawGrayscaleBitmap(gfx_coord_t x, gfx_coord_t y, uint8_t* bitmap, gfx_coord_t w, gfx_coord_t h);
 
     /*!
         @brief    Draw a PROGMEM-resident 8-bit image (grayscale) with a 1-bit mask
@@ -367,7 +488,7 @@ public:
         @param    w   Width of bitmap in pixels
         @param    h   Height of bitmap in pixels
     */
-    void drawGrayscaleBitmap(int16_t x, int16_t y, const uint8_t bitmap[], const uint8_t mask[], int16_t w, int16_t h);
+    void drawGrayscaleBitmap(gfx_coord_t x, gfx_coord_t y, const uint8_t bitmap[], const uint8_t mask[], gfx_coord_t w, gfx_coord_t h);
 
     /*!
         @brief    Draw a RAM-resident 8-bit image (grayscale) with a 1-bit mask
@@ -380,7 +501,62 @@ public:
         @param    w   Width of bitmap in pixels
         @param    h   Height of bitmap in pixels
     */
-    void drawGrayscaleBitmap(int16_t x, int16_t y, uint8_t* bitmap, uint8_t* mask, int16_t w, int16_t h);
+    void drawGrayscaleBitmap(gfx_coord_t x, gfx_coord_t y, uint8_t* bitmap, uint8_t* mask, gfx_coord_t w, gfx_coord_t h);
+
+    /*!
+        @brief    Draw a PROGMEM-resident grayscale image tinted for 16-bit display devices: each value selects a blend
+                  of fg over bg (0 = bg, maximum = fg) from a lookup table built once per call, rows are written with writeRGBSpan()
+        @param    x   Top left corner x coordinate
+        @param    y   Top left corner y coordinate
+        @param    bitmap  byte array with 8-bit values, or 4-bit values packed high nibble first with rows padded to whole bytes
+        @param    w   Width of bitmap in pixels
+        @param    h   Height of bitmap in pixels
+        @param    fg  16-bit 5-6-5 Color of the maximum value
+        @param    bg  16-bit 5-6-5 Color of value 0
+        @param    depth  Bits per pixel, 4 or 8, nothing is drawn otherwise
+    */
+    void drawGrayscaleBitmap(gfx_coord_t x, gfx_coord_t y, const uint8_t bitmap[], gfx_coord_t w, gfx_coord_t h, uint16_t fg, uint16_t bg, uint8_t depth = 8);
+
+    /*!
+        @brief    Draw a PROGMEM-resident alpha mask in one color over the existing pixels. Rows are read back with readRGBSpan(),
+                  blended and written with writeRGBSpan(); targets that can't read back get one writeFastHLineAlpha() per run of equal alpha.
+        @param    x   Top left corner x coordinate
+        @param    y   Top left corner y coordinate
+        @param    bitmap  byte array with 8-bit alpha values, or 4-bit values packed high nibble first with rows padded to whole bytes
+        @param    w   Width of bitmap in pixels
+        @param    h   Height of bitmap in pixels
+        @param    color  16-bit 5-6-5 Color to blend with
+        @param    depth  Bits per pixel, 4 or 8, nothing is drawn otherwise
+    */
+    void drawAlphaBitmap(gfx_coord_t x, gfx_coord_t y, const uint8_t bitmap[], gfx_coord_t w, gfx_coord_t h, uint16_t color, uint8_t depth = 8);
+
+    /*!
+        @brief    Draw a PROGMEM-resident indexed-color image for 16-bit display devices. Rows are expanded through the
+                  palette into a 32-pixel RAM chunk passed to writeRGBSpan(), pixels with the transparent index split
+                  them into runs.
+        @param    x   Top left corner x coordinate
+        @param    y   Top left corner y coordinate
+        @param    bitmap  byte array with palette indexes, packed most significant bits first with rows padded to whole bytes
+        @param    palette  16-bit 5-6-5 colors, indexed by the pixels
+        @param    w   Width of bitmap in pixels
+        @param    h   Height of bitmap in pixels
+        @param    depth  Bits per pixel, 1, 2, 4 or 8, nothing is drawn otherwise
+        @param    transparent  Index of the pixels not to draw, -1 to draw all
+    */
+    void drawIndexedBitmap(gfx_coord_t x, gfx_coord_t y, const uint8_t bitmap[], const uint16_t palette[], gfx_coord_t w, gfx_coord_t h, uint8_t depth,
+        int16_t transparent = -1);
+
+    /*!
+        @brief    Draw an indexed-color image made by fontconvert/palconvert, see above
+        @param    x   Top left corner x coordinate
+        @param    y   Top left corner y coordinate
+        @param    bitmap  Indexed bitmap, nothing is drawn if nullptr
+    */
+    void drawIndexedBitmap(gfx_coord_t x, gfx_coord_t y, const GFXindexedBitmap* bitmap) {
+        if (bitmap) {
+            drawIndexedBitmap(x, y, bitmap->bitmap, bitmap->palette, bitmap->width, bitmap->height, bitmap->depth, bitmap->transparent);
+        }
+    }
 
     /*!
         @brief    Draw a PROGMEM-resident 16-bit image (RGB 5/6/5) at the specified (x,y) position.
@@ -391,7 +567,7 @@ public:
         @param    w   Width of bitmap in pixels
         @param    h   Height of bitmap in pixels
     */
-    void drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w, int16_t h);
+    void drawRGBBitmap(gfx_coord_t x, gfx_coord_t y, const uint16_t bitmap[], gfx_coord_t w, gfx_coord_t h);
 
     /*!
         @brief    Draw a RAM-resident 16-bit image (RGB 5/6/5) at the specified (x,y) position.
@@ -402,7 +578,7 @@ public:
         @param    w   Width of bitmap in pixels
         @param    h   Height of bitmap in pixels
     */
-    void drawRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w, int16_t h);
+    virtual void drawRGBBitmap(gfx_coord_t x, gfx_coord_t y, uint16_t* bitmap, gfx_coord_t w, gfx_coord_t h);
 
     /*!
         @brief    Draw a PROGMEM-resident 16-bit image (RGB 5/6/5) with a 1-bit mask (set bits = opaque, unset bits = clear) at the specified (x,y) position.
@@ -414,7 +590,7 @@ public:
         @param    w   Width of bitmap in pixels
         @param    h   Height of bitmap in pixels
     */
-    void drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], const uint8_t mask[], int16_t w, int16_t h);
+    void drawRGBBitmap(gfx_coord_t x, gfx_coord_t y, const uint16_t bitmap[], const uint8_t mask[], gfx_coord_t w, gfx_coord_t h);
 
     /*!
         @brief    Draw a RAM-resident 16-bit image (RGB 5/6/5) with a 1-bit mask (set bits = opaque, unset bits = clear) at the specified (x,y) position.
@@ -426,7 +602,44 @@ public:
         @param    w   Width of bitmap in pixels
         @param    h   Height of bitmap in pixels
     */
-    void drawRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, uint8_t* mask, int16_t w, int16_t h);
+    void drawRGBBitmap(gfx_coord_t x, gfx_coord_t y, uint16_t* bitmap, uint8_t* mask, gfx_coord_t w, gfx_coord_t h);
+
+    /*!
+        @brief    Draw an icon of an atlas made by fontconvert/atlaspack, row by row: 16-bit atlases as one
+                  writeRGBSpan() per 32 pixels of a row, 1-bit atlases as one writeFastHLine() per run of set pixels
+        @param    atlas  Atlas, nothing is drawn if nullptr
+        @param    id  Icon id, nothing is drawn if out of range
+        @param    x   Top left corner x coordinate
+        @param    y   Top left corner y coordinate
+        @param    color  16-bit 5-6-5 Color of the set pixels of a 1-bit atlas, unused for 16-bit atlases
+    */
+    void drawIcon(const GFXatlas* atlas, uint16_t id, gfx_coord_t x, gfx_coord_t y, uint16_t color = 0xffff);
+
+    /*!
+        @brief    Draw a nine-patch made by fontconvert/ninepatch at any size. The corners are drawn once, the stretchable
+                  columns and rows are repeated. Each source row is scanned once: segments of one color become
+                  writeFastHLine() or fillRect() calls, the others writeRGBSpan() calls from a RAM chunk holding the source
+                  pixels, tiled once per source row if the segment is at most 32 pixels wide.
+                  If w or h is smaller than the fixed borders, the borders are cut in proportion.
+        @param    patch  Nine-patch, nothing is drawn if nullptr
+        @param    x   Top left corner x coordinate
+        @param    y   Top left corner y coordinate
+        @param    w   Width in pixels
+        @param    h   Height in pixels
+    */
+    void drawNinePatch(const GFXninePatch* patch, gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h);
+
+    /*!
+        @brief    Draw a list of horizontal spans in one transaction, e.g. text rasterized at compile time with
+                  GFX_STATIC_TEXT()
+        @param    x   Origin x coordinate
+        @param    y   Origin y coordinate
+        @param    spans  Spans relative to the origin, at size 1
+        @param    count  Number of spans
+        @param    color  16-bit 5-6-5 Color to draw with
+        @param    size   Magnification, every span becomes a size x size high rectangle
+    */
+    void drawSpans(gfx_coord_t x, gfx_coord_t y, const GFXspan spans[], size_t count, uint16_t color, uint8_t size = 1);
 
     /*!
         @brief    Draw a single character
@@ -437,16 +650,17 @@ public:
         @param    bg 16-bit 5-6-5 Color to fill background with (if same as color, no background)
         @param    size  Font magnification level, 1 is 'original' size
     */
-    void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size);
+    void drawChar(gfx_coord_t x, gfx_coord_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size);
 
     /*!
         @brief  Set text cursor location
         @param  x    X coordinate in pixels
         @param  y    Y coordinate in pixels
     */
-    void setCursor(int16_t x, int16_t y) {
+    void setCursor(gfx_coord_t x, gfx_coord_t y) {
         cursor_x = x;
         cursor_y = y;
+        texteffectprev = -1;
     }
 
     /*!
@@ -468,12 +682,30 @@ public:
         textbgcolor = b;
     }
 
+    /*!
+        @brief   Draw text with an outline or drop shadow, e.g. for legibility over images. The glyph mask is dilated
+                 (or shifted) row by row, and every pixel is written once in either the text, the effect or the
+                 background color. The effect scales with the text size and extends one glyph pixel beyond the bounds
+                 reported by getTextBounds(). With the classic font and an opaque background the 6 x 8 cells are
+                 filled with the background and the effect is drawn on top of them, also where it reaches into the
+                 cell of a neighbouring character; printing the text repeatedly at offsets would erase it there.
+                 Glyphs wider than 62 pixels are drawn without effect.
+        @param   effect  Effect to draw, GFXtextEffect::None to turn it off
+        @param   color   16-bit 5-6-5 Color of the outline or shadow
+    */
+    void setTextEffect(GFXtextEffect effect, uint16_t color = 0) {
+        texteffect = effect;
+        texteffectcolor = color;
+        texteffectprev = -1;
+    }
+
     /*!
         @brief   Set text 'magnification' size. Each increase in s makes 1 pixel that much bigger.
         @param  s  Desired text size. 1 is default 6x8, 2 is 12x16, 3 is 18x24, etc
     */
     void setTextSize(uint8_t s) {
         textsize = (s > 0) ? s : 1;
+        texteffectprev = -1;
     }
 
     /*!
@@ -514,7 +746,7 @@ public:
         @param    w      The boundary width, set by function
         @param    h      The boundary height, set by function
     */
-    void getTextBounds(const char* string, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h);
+    void getTextBounds(const char* string, gfx_coord_t x, gfx_coord_t y, gfx_coord_t* x1, gfx_coord_t* y1, gfx_ucoord_t* w, gfx_ucoord_t* h);
 
     /*!
         @brief    Helper to determine size of a string with current font/size. Pass string and a cursor position, returns UL corner and W,H.
@@ -526,7 +758,7 @@ public:
         @param    w      The boundary width, set by function
         @param    h      The boundary height, set by function
     */
-    void getTextBounds(const String& str, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h);
+    void getTextBounds(const String& str, gfx_coord_t x, gfx_coord_t y, gfx_coord_t* x1, gfx_coord_t* y1, gfx_ucoord_t* w, gfx_ucoord_t* h);
 
     /*!
         @brief  Print one byte/character of data, used to support print()
@@ -538,7 +770,7 @@ public:
         @brief      Get height of the display, accounting for the current rotation
         @returns    Height in pixels
     */
-    int16_t height() const {
+    gfx_coord_t height() const {
         return _height;
     }
 
@@ -546,7 +778,7 @@ public:
         @brief      Get width of the display, accounting for the current rotation
         @returns    Width in pixels
     */
-    int16_t width() const {
+    gfx_coord_t width() const {
         return _width;
     }
 
@@ -562,7 +794,7 @@ public:
         @brief  Get text cursor X location
         @returns    X coordinate in pixels
     */
-    int16_t getCursorX() const {
+    gfx_coord_t getCursorX() const {
         return cursor_x;
     }
 
@@ -570,11 +802,58 @@ public:
         @brief      Get text cursor Y location
         @returns    Y coordinate in pixels
     */
-    int16_t getCursorY() const {
+    gfx_coord_t getCursorY() const {
         return cursor_y;
     }
 
+    /*!
+        @brief    Blend two 16-bit 5-6-5 colors
+        @param    fg     Foreground color
+        @param    bg     Background color
+        @param    alpha  Weight of the foreground color, 0 = bg only, 255 = fg only
+        @returns  Blended 16-bit 5-6-5 color
+    */
+    static uint16_t blend565(uint16_t fg, uint16_t bg, uint8_t alpha) {
+        // Spread the channels to 0b00000gggggg00000rrrrr000000bbbbb so one multiply handles all three
+        const uint32_t a { (alpha + 4U) >> 3 };
+        const uint32_t f { (fg | (static_cast<uint32_t>(fg) << 16)) & 0x07e0f81f };
+        uint32_t b { (bg | (static_cast<uint32_t>(bg) << 16)) & 0x07e0f81f };
+        b += ((f - b) * a) >> 5;
+        b &= 0x07e0f81f;
+        return static_cast<uint16_t>(b | (b >> 16));
+    }
+
 protected:
+    /*!
+        @brief    Read one value of a PROGMEM-resident grayscale or alpha bitmap row
+        @param    row    First byte of the row
+        @param    i      Pixel index in the row
+        @param    depth  Bits per pixel, 4 (packed high nibble first) or 8
+        @returns  Value scaled to 0-255
+    */
+    static uint8_t grayLevel(const uint8_t row[], gfx_coord_t i, uint8_t depth) {
+        if (depth == 4) {
+            const uint8_t byte { pgm_read_byte(&row[i / 2]) };
+            return static_cast<uint8_t>(((i & 1) ? (byte & 0xf) : (byte >> 4)) * 17);
+        }
+        return pgm_read_byte(&row[i]);
+    }
+
+    /*!
+        @brief    Draw one source row of a nine-patch into count destination rows, helper of drawNinePatch()
+        @param    patch  Nine-patch
+        @param    row    Source row
+        @param    x      Left edge of the destination
+        @param    y      First destination row
+        @param    count  Number of destination rows
+        @param    step   Distance between the destination rows, 1 if they are contiguous
+        @param    lw     Width of the left border in the destination
+        @param    mw     Width of the stretched part in the destination
+        @param    rw     Width of the right border in the destination
+    */
+    void drawNinePatchRow(const GFXninePatch& patch, uint16_t row, gfx_coord_t x, gfx_coord_t y, gfx_coord_t count, gfx_coord_t step,
+        gfx_coord_t lw, gfx_coord_t mw, gfx_coord_t rw);
+
     /*!
         @brief    Helper to determine size of a character with current font/size.
                   Broke this out as it's used by both the PROGMEM- and RAM-resident getTextBounds() functions.
@@ -586,16 +865,69 @@ protected:
         @param    maxx  Maximum clipping value for X
         @param    maxy  Maximum clipping value for Y
     */
-    void charBounds(char c, int16_t* x, int16_t* y, int16_t* minx, int16_t* miny, int16_t* maxx, int16_t* maxy);
+    void charBounds(char c, gfx_coord_t* x, gfx_coord_t* y, gfx_coord_t* minx, gfx_coord_t* miny, gfx_coord_t* maxx, gfx_coord_t* maxy);
+
+    /// Rows of a glyph as bit masks with a one pixel border, bit k is glyph column k - 1
+    struct GlyphMask {
+        const uint8_t* bitmap; ///< Glyph bitmap
+        uint8_t w; ///< Glyph width
+        uint8_t h; ///< Glyph height, 0 for none
+        int8_t xo; ///< x offset from the cursor
+        int8_t yo; ///< y offset from the cursor
+        bool classic; ///< Column-major classic font bitmap
+
+        /// Mask of row r, 0 outside of the glyph
+        uint64_t row(int16_t r) const;
+    };
+
+    /*!
+        @brief    Get the bitmap of a character of the current font, as drawn by drawChar()
+        @param    c  The character
+        @returns  Glyph masks, empty if the font has no such glyph
+    */
+    GlyphMask glyphMask(unsigned char c) const;
+
+    /*!
+        @brief    Draw a character with the current text effect, see drawChar() for the first parameters
+        @param    prev    Previous character of the text, whose pixels the effect mustn't cover, -1 for none
+        @param    prev_x  Cursor x coordinate of the previous character
+        @param    prev_y  Cursor y coordinate of the previous character
+        @returns  False if the glyph is too wide for the effect and has to be drawn plain
+    */
+    bool drawCharEffect(gfx_coord_t x, gfx_coord_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size, int16_t prev = -1, gfx_coord_t prev_x = 0,
+        gfx_coord_t prev_y = 0);
+
+    /*!
+        @brief    Draw a character of print() at the cursor, with the text effect if set
+        @param    c  The character
+    */
+    void drawTextChar(unsigned char c);
+
+    /*!
+        @brief    Write a line as horizontal or vertical runs instead of single pixels. Same pixels as writeLine(),
+                  but every run of more than one pixel becomes one writeFastHLine() or writeFastVLine() call.
+        @param    x0  Start point x coordinate
+        @param    y0  Start point y coordinate
+        @param    x1  End point x coordinate
+        @param    y1  End point y coordinate
+        @param    color 16-bit 5-6-5 Color to draw with
+        @param    skip_first  If true, the start point is not written (it was written as end point of the previous segment)
+    */
+    void writeLineSpans(gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t x1, gfx_coord_t y1, uint16_t color, bool skip_first = false);
 
-    const int16_t WIDTH; ///< This is the 'raw' display width - never changes
-    const int16_t HEIGHT; ///< This is the 'raw' display height - never changes
-    int16_t _width; ///< Display width as modified by current rotation
-    int16_t _height; ///< Display height as modified by current rotation
-    int16_t cursor_x; ///< x location to start print()ing text
-    int16_t cursor_y; ///< y location to start print()ing text
+    const gfx_coord_t WIDTH; ///< This is the 'raw' display width - never changes
+    const gfx_coord_t HEIGHT; ///< This is the 'raw' display height - never changes
+    gfx_coord_t _width; ///< Display width as modified by current rotation
+    gfx_coord_t _height; ///< Display height as modified by current rotation
+    gfx_coord_t cursor_x; ///< x location to start print()ing text
+    gfx_coord_t cursor_y; ///< y location to start print()ing text
     uint16_t textcolor; ///< 16-bit background color for print()
     uint16_t textbgcolor; ///< 16-bit text color for print()
+    uint16_t texteffectcolor; ///< 16-bit outline or shadow color for print()
+    GFXtextEffect texteffect; ///< Outline or shadow around text
+    int16_t texteffectprev; ///< Last character drawn by print(), -1 if none
+    gfx_coord_t texteffectprevx; ///< Cursor x coordinate of the last character drawn by print()
+    gfx_coord_t texteffectprevy; ///< Cursor y coordinate of the last character drawn by print()
     uint8_t textsize; ///< Desired magnification of text to print()
     uint8_t rotation; ///< Display rotation (0 thru 3)
     bool wrap; ///< If set, 'wrap' text at right edge of display
@@ -626,8 +958,8 @@ public:
         @param    textsize The font magnification of the label text
         @note     Classic initButton() function: pass center & size
     */
-    void initButton(
-        Adafruit_GFX* gfx, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t outline, uint16_t fill, uint16_t textcolor, char* label, uint8_t textsize) {
+    void initButton(Adafruit_GFX* gfx, gfx_coord_t x, gfx_coord_t y, gfx_ucoord_t w, gfx_ucoord_t h, uint16_t outline, uint16_t fill, uint16_t textcolor,
+        char* label, uint8_t textsize) {
         // Tweak arguments and pass to the newer initButtonUL() function...
         initButtonUL(gfx, x - (w / 2), y - (h / 2), w, h, outline, fill, textcolor, label, textsize);
     }
@@ -645,8 +977,8 @@ public:
         @param    label  Ascii string of the text inside the button
         @param    textsize The font magnification of the label text
     */
-    void initButtonUL(
-        Adafruit_GFX* gfx, int16_t x1, int16_t y1, uint16_t w, uint16_t h, uint16_t outline, uint16_t fill, uint16_t textcolor, char* label, uint8_t textsize);
+    void initButtonUL(Adafruit_GFX* gfx, gfx_coord_t x1, gfx_coord_t y1, gfx_ucoord_t w, gfx_ucoord_t h, uint16_t outline, uint16_t fill, uint16_t textcolor,
+        char* label, uint8_t textsize);
 
     /*!
         @brief    Draw the button on the screen
@@ -660,7 +992,7 @@ public:
         @param    y       The Y coordinate to check
         @returns  True if within button graphics outline
     */
-    bool contains(int16_t x, int16_t y) const;
+    bool contains(gfx_coord_t x, gfx_coord_t y) const;
 
     /*!
         @brief    Sets the state of the button, should be done by some touch function
@@ -694,7 +1026,7 @@ public:
 
 private:
     Adafruit_GFX* _gfx;
-    int16_t _x1, _y1; // Coordinates of top-left corner
+    gfx_coord_t _x1, _y1; // Coordinates of top-left corner
     uint16_t _w, _h;
     uint8_t _textsize;
     uint16_t _outlinecolor, _fillcolor, _textcolor;
@@ -711,7 +1043,7 @@ public:
         @param    w   Display width, in pixels
         @param    h   Display height, in pixels
     */
-    GFXcanvas1(uint16_t w, uint16_t h);
+    GFXcanvas1(gfx_ucoord_t w, gfx_ucoord_t h);
 
     /*!
         @brief    Delete the canvas, free memory
@@ -724,7 +1056,7 @@ public:
         @param   y   y coordinate
         @param    color 16-bit 5-6-5 Color to fill with
     */
-    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    virtual void drawPixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) override;
 
     /*!
         @brief    Fill the framebuffer completely with one color
@@ -732,6 +1064,14 @@ public:
     */
     virtual void fillScreen(uint16_t color) override;
 
+    /*!
+        @brief    Get the pixel color value at a given coordinate
+        @param    x   x coordinate
+        @param    y   y coordinate
+        @returns  The desired pixel's binary color value, either 0x1 (on) or 0x0 (off)
+    */
+    bool getPixel(gfx_coord_t x, gfx_coord_t y) const;
+
     /*!
         @brief    Get a pointer to the internal buffer memory
         @returns  A pointer to the allocated buffer
@@ -753,7 +1093,7 @@ public:
         @param    w   Display width, in pixels
         @param    h   Display height, in pixels
     */
-    GFXcanvas8(uint16_t w, uint16_t h);
+    GFXcanvas8(gfx_ucoord_t w, gfx_ucoord_t h);
 
     /*!
         @brief    Delete the canvas, free memory
@@ -766,7 +1106,7 @@ public:
         @param   y   y coordinate
         @param   color 16-bit 5-6-5 Color to fill with
     */
-    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    virtual void drawPixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) override;
 
     /*!
         @brief    Fill the framebuffer completely with one color
@@ -774,7 +1114,25 @@ public:
     */
     virtual void fillScreen(uint16_t color) override;
 
-    virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    virtual void writeFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) override;
+
+    /*!
+        @brief    Blend a horizontal line into the canvas, the 8-bit values are interpolated linearly
+        @param    x   Left-most x coordinate
+        @param    y   Left-most y coordinate
+        @param    w   Width in pixels
+        @param    color 8-bit color to blend with (lower byte of color)
+        @param    alpha  Coverage, 0 = transparent, 255 = opaque
+    */
+    virtual void writeFastHLineAlpha(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color, uint8_t alpha) override;
+
+    /*!
+        @brief    Get the pixel color value at a given coordinate
+        @param    x   x coordinate
+        @param    y   y coordinate
+        @returns  The desired pixel's 8-bit color value, 0 if outside of the canvas
+    */
+    uint8_t getPixel(gfx_coord_t x, gfx_coord_t y) const;
 
     /*!
         @brief    Get a pointer to the internal buffer memory
@@ -796,8 +1154,10 @@ public:
         @brief    Instatiate a GFX 16-bit canvas context for graphics
         @param    w   Display width, in pixels
         @param    h   Display height, in pixels
+        @param    big_endian  Store pixels byte swapped (most significant byte first), as SPI panels expect them. Drawing
+                              swaps each color once per call, and the buffer can be sent to a display without a copy.
     */
-    GFXcanvas16(uint16_t w, uint16_t h);
+    GFXcanvas16(gfx_ucoord_t w, gfx_ucoord_t h, bool big_endian = false);
 
     /*!
     @brief    Delete the canvas, free memory
@@ -810,7 +1170,7 @@ public:
         @param   y   y coordinate
         @param   color 16-bit 5-6-5 Color to fill with
     */
-    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    virtual void drawPixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) override;
 
     /*!
         @brief    Fill the framebuffer completely with one color
@@ -818,14 +1178,108 @@ public:
     */
     virtual void fillScreen(uint16_t color) override;
 
+    /*!
+        @brief    Write a perfectly horizontal line to the canvas
+        @param    x   Left-most x coordinate
+        @param    y   Left-most y coordinate
+        @param    w   Width in pixels
+        @param    color 16-bit 5-6-5 Color to fill with
+    */
+    virtual void writeFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) override;
+
+    /*!
+        @brief    Fill a rectangle row by row
+        @param    x   Top left corner x coordinate
+        @param    y   Top left corner y coordinate
+        @param    w   Width in pixels
+        @param    h   Height in pixels
+        @param    color 16-bit 5-6-5 Color to fill with
+    */
+    virtual void fillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) override;
+
+    /*!
+        @brief    Blend a horizontal line into the canvas
+        @param    x   Left-most x coordinate
+        @param    y   Left-most y coordinate
+        @param    w   Width in pixels
+        @param    color 16-bit 5-6-5 Color to blend with
+        @param    alpha  Coverage, 0 = transparent, 255 = opaque
+    */
+    virtual void writeFastHLineAlpha(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color, uint8_t alpha) override;
+
+    /*!
+        @brief    Copy a row of pixels into the canvas
+        @param    x   Left-most x coordinate
+        @param    y   y coordinate
+        @param    colors  w 16-bit 5-6-5 colors
+        @param    w   Width in pixels
+    */
+    virtual void writeRGBSpan(gfx_coord_t x, gfx_coord_t y, const uint16_t colors[], gfx_coord_t w) override;
+
+    /*!
+        @brief    Copy a row of pixels out of the canvas
+        @param    x   Left-most x coordinate
+        @param    y   y coordinate
+        @param    colors  Receives w 16-bit 5-6-5 colors, pixels outside of the canvas read as 0
+        @param    w   Width in pixels
+        @returns  True if the canvas has a buffer
+    */
+    virtual bool readRGBSpan(gfx_coord_t x, gfx_coord_t y, uint16_t colors[], gfx_coord_t w) override;
+
+    using Adafruit_GFX::drawRGBBitmap;
+
+    /*!
+        @brief    Copy a RAM-resident 16-bit image into the canvas, row by row
+        @param    x   Top left corner x coordinate
+        @param    y   Top left corner y coordinate
+        @param    bitmap  Byte array with 16-bit color bitmap
+        @param    w   Width of bitmap in pixels
+        @param    h   Height of bitmap in pixels
+    */
+    virtual void drawRGBBitmap(gfx_coord_t x, gfx_coord_t y, uint16_t* bitmap, gfx_coord_t w, gfx_coord_t h) override;
+
+    /*!
+        @brief    Get the pixel color value at a given coordinate
+        @param    x   x coordinate
+        @param    y   y coordinate
+        @returns  The desired pixel's 16-bit 5-6-5 color value, 0 if outside of the canvas
+    */
+    uint16_t getPixel(gfx_coord_t x, gfx_coord_t y) const;
+
     /*!
         @brief    Get a pointer to the internal buffer memory
-        @returns  A pointer to the allocated buffer
+        @returns  A pointer to the allocated buffer, pixels in the byte order given by isBigEndian()
     */
     uint16_t* getBuffer() {
         return buffer;
     }
 
+    /*!
+        @brief    Query the byte order of the buffer
+        @returns  True if pixels are stored most significant byte first
+    */
+    bool isBigEndian() const {
+        return big_endian;
+    }
+
+    /*!
+        @brief    Swap the bytes of a color, converts between the two storage orders
+        @param    color  16-bit 5-6-5 color
+        @returns  Swapped color
+    */
+    static constexpr uint16_t swapBytes(uint16_t color) {
+        return static_cast<uint16_t>((color << 8) | (color >> 8));
+    }
+
 private:
+    /// Convert a color to or from the storage byte order
+    uint16_t stored(uint16_t color) const {
+        return big_endian ? swapBytes(color) : color;
+    }
+
+    /// Clip a logical row to the canvas, get its first pixel and the buffer step between its pixels, nullptr if empty
+    uint16_t* row(gfx_coord_t& x, gfx_coord_t y, gfx_coord_t& w, ptrdiff_t& step) const;
+
     uint16_t* buffer;
+    const bool big_endian;
 };
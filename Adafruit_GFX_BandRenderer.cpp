@@ -0,0 +1,288 @@
+/*!
+ * @file Adafruit_GFX_BandRenderer.cpp
+ *
+ * Part of Adafruit's GFX graphics library. Multi-threaded replay of a
+ * display list into a GFXcanvas16 for host builds (Linux, macOS, Windows),
+ * e.g. to render UI previews or large canvases on a PC.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_GFX_BandRenderer.h"
+
+#if ADAFRUIT_GFX_HOST_THREADS
+#include <algorithm>
+
+
+namespace {
+
+/*!
+ * @brief  View of the rows y0 .. y1 - 1 of a GFXcanvas16's buffer. Draws
+ *         exactly like the canvas itself, but clips to the band, so several
+ *         views of the same canvas can be drawn to concurrently.
+ */
+class BandView : public Adafruit_GFX {
+public:
+    BandView(GFXcanvas16& canvas, gfx_coord_t y0, gfx_coord_t y1)
+        : Adafruit_GFX((canvas.getRotation() & 1) ? canvas.height() : canvas.width(), (canvas.getRotation() & 1) ? canvas.width() : canvas.height()),
+          _buffer { canvas.getBuffer() }, _y0 { y0 }, _y1 { y1 }, _big_endian { canvas.isBigEndian() } {
+        setRotation(canvas.getRotation());
+    }
+
+    virtual void drawPixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) override {
+        if ((x < 0) || (y < _y0) || (x >= _width) || (y >= _y1)) {
+            return;
+        }
+        *address(x, y) = stored(color);
+    }
+
+    virtual void writeFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) override {
+        if (w <= 0) {
+            // Keep the generic behaviour for degenerate sizes
+            Adafruit_GFX::writeFastHLine(x, y, w, color);
+            return;
+        }
+        if ((y < _y0) || (y >= _y1)) {
+            return;
+        }
+        const gfx_coord_t x2 { static_cast<gfx_coord_t>(std::min<int32_t>(x + w, _width)) };
+        x = std::max<gfx_coord_t>(x, 0);
+        if (x < x2) {
+            span(x, y, x2 - x, color);
+        }
+    }
+
+    virtual void writeFastVLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t h, uint16_t color) override {
+        if (h <= 0) {
+            Adafruit_GFX::writeFastVLine(x, y, h, color);
+            return;
+        }
+        if ((x < 0) || (x >= _width)) {
+            return;
+        }
+        const gfx_coord_t y2 { static_cast<gfx_coord_t>(std::min<int32_t>(y + h, _y1)) };
+        color = stored(color);
+        for (y = std::max(y, _y0); y < y2; y++) {
+            *address(x, y) = color;
+        }
+    }
+
+    virtual void fillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) override {
+        if ((w <= 0) || (h <= 0)) {
+            Adafruit_GFX::fillRect(x, y, w, h, color);
+            return;
+        }
+        const gfx_coord_t x2 { static_cast<gfx_coord_t>(std::min<int32_t>(x + w, _width)) };
+        const gfx_coord_t y2 { static_cast<gfx_coord_t>(std::min<int32_t>(y + h, _y1)) };
+        x = std::max<gfx_coord_t>(x, 0);
+        if (x >= x2) {
+            return;
+        }
+        for (y = std::max(y, _y0); y < y2; y++) {
+            span(x, y, x2 - x, color);
+        }
+    }
+
+    virtual void fillScreen(uint16_t color) override {
+        for (gfx_coord_t y { _y0 }; y < _y1; y++) {
+            span(0, y, _width, color);
+        }
+    }
+
+    virtual void writeFastHLineAlpha(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color, uint8_t alpha) override {
+        if (alpha == 255) {
+            writeFastHLine(x, y, w, color);
+            return;
+        }
+        if (!alpha || (y < _y0) || (y >= _y1)) {
+            return;
+        }
+
+        const gfx_coord_t x2 { static_cast<gfx_coord_t>(std::min<int32_t>(x + w, _width)) };
+        for (x = std::max<gfx_coord_t>(x, 0); x < x2; x++) {
+            uint16_t* p { address(x, y) };
+            *p = stored(blend565(color, stored(*p), alpha));
+        }
+    }
+
+private:
+    /// Buffer address of a (clipped) logical coordinate, same mapping as GFXcanvas16
+    uint16_t* address(gfx_coord_t x, gfx_coord_t y) const {
+        gfx_coord_t t;
+        switch (rotation) {
+            case 1:
+                t = x;
+                x = WIDTH - 1 - y;
+                y = t;
+                break;
+            case 2:
+                x = WIDTH - 1 - x;
+                y = HEIGHT - 1 - y;
+                break;
+            case 3:
+                t = x;
+                x = y;
+                y = HEIGHT - 1 - t;
+                break;
+        }
+        return _buffer + x + static_cast<size_t>(y) * WIDTH;
+    }
+
+    /// Convert a color to or from the canvas' byte order
+    uint16_t stored(uint16_t color) const {
+        return _big_endian ? GFXcanvas16::swapBytes(color) : color;
+    }
+
+    /// Fill a clipped, non-empty logical row segment
+    void span(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) {
+        color = stored(color);
+        switch (rotation) {
+            case 0: std::fill_n(address(x, y), w, color); break;
+            case 2: std::fill_n(address(x + w - 1, y), w, color); break;
+            default: {
+                // Logical rows are buffer columns, walk them with the row stride
+                uint16_t* p { address(x, y) };
+                const ptrdiff_t stride { rotation == 1 ? WIDTH : -WIDTH };
+                for (; w > 0; w--, p += stride) {
+                    *p = color;
+                }
+                break;
+            }
+        }
+    }
+
+    uint16_t* const _buffer;
+    const gfx_coord_t _y0;
+    const gfx_coord_t _y1;
+    const bool _big_endian;
+};
+
+} // namespace
+
+
+GFXbandRenderer::GFXbandRenderer(uint8_t threads, gfx_coord_t band_height)
+    : _generation {}, _busy {}, _quit { false }, _band_height { std::max<gfx_coord_t>(band_height, 1) }, _rows { _band_height }, _list {}, _canvas {} {
+    if (!threads) {
+        threads = static_cast<uint8_t>(std::min(std::max(std::thread::hardware_concurrency(), 1U), 255U));
+    }
+    _queues = std::vector<Queue>(threads);
+    for (uint8_t i { 1 }; i < threads; ++i) {
+        _threads.emplace_back(&GFXbandRenderer::worker, this, i);
+    }
+}
+
+GFXbandRenderer::~GFXbandRenderer() {
+    {
+        std::lock_guard<std::mutex> lock { _mutex };
+        _quit = true;
+    }
+    _wake.notify_all();
+    for (auto& t : _threads) {
+        t.join();
+    }
+}
+
+void GFXbandRenderer::render(const GFXdisplayList& list, GFXcanvas16& canvas) {
+    if (!canvas.getBuffer()) {
+        return;
+    }
+
+    const uint32_t workers { static_cast<uint32_t>(_queues.size()) };
+    // Band indices are 16 bit, very tall canvases get taller bands
+    const gfx_coord_t rows { static_cast<gfx_coord_t>(std::max<int32_t>(_band_height, (canvas.height() + UINT16_MAX - 1) / UINT16_MAX)) };
+    const uint32_t bands { static_cast<uint32_t>((canvas.height() + rows - 1) / rows) };
+    for (uint32_t i { 0 }; i < workers; ++i) {
+        const uint32_t front { i * bands / workers };
+        const uint32_t back { (i + 1) * bands / workers };
+        _queues[i].range.store(front << 16 | back, std::memory_order_relaxed);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock { _mutex };
+        _list = &list;
+        _canvas = &canvas;
+        _rows = rows;
+        _busy = static_cast<uint8_t>(workers - 1);
+        ++_generation;
+    }
+    _wake.notify_all();
+
+    // The calling thread is worker 0
+    run(0);
+
+    std::unique_lock<std::mutex> lock { _mutex };
+    _done.wait(lock, [this] { return _busy == 0; });
+    _list = nullptr;
+    _canvas = nullptr;
+}
+
+void GFXbandRenderer::worker(uint8_t index) {
+    uint32_t seen { 0 };
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock { _mutex };
+            _wake.wait(lock, [this, seen] { return _quit || _generation != seen; });
+            if (_quit) {
+                return;
+            }
+            seen = _generation;
+        }
+
+        run(index);
+
+        {
+            std::lock_guard<std::mutex> lock { _mutex };
+            --_busy;
+        }
+        _done.notify_one();
+    }
+}
+
+void GFXbandRenderer::run(uint8_t index) {
+    while (true) {
+        int32_t band { pop(index) };
+        if (band < 0) {
+            band = steal(index);
+            if (band < 0) {
+                return;
+            }
+        }
+        renderBand(static_cast<uint16_t>(band));
+    }
+}
+
+int32_t GFXbandRenderer::pop(uint8_t index) {
+    std::atomic<uint32_t>& range { _queues[index].range };
+    uint32_t r { range.load(std::memory_order_relaxed) };
+    while ((r >> 16) < (r & 0xffff)) {
+        // Owner takes bands from the front
+        if (range.compare_exchange_weak(r, r + 0x10000, std::memory_order_acquire, std::memory_order_relaxed)) {
+            return static_cast<int32_t>(r >> 16);
+        }
+    }
+    return -1;
+}
+
+int32_t GFXbandRenderer::steal(uint8_t index) {
+    const size_t workers { _queues.size() };
+    for (size_t i { 1 }; i < workers; ++i) {
+        std::atomic<uint32_t>& range { _queues[(index + i) % workers].range };
+        uint32_t r { range.load(std::memory_order_relaxed) };
+        while ((r >> 16) < (r & 0xffff)) {
+            // Thieves take bands from the back, far away from the owner's current position
+            if (range.compare_exchange_weak(r, r - 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return static_cast<int32_t>((r & 0xffff) - 1);
+            }
+        }
+    }
+    return -1;
+}
+
+void GFXbandRenderer::renderBand(uint16_t band) {
+    const gfx_coord_t y0 { static_cast<gfx_coord_t>(band * _rows) };
+    const gfx_coord_t y1 { static_cast<gfx_coord_t>(std::min<int32_t>(y0 + _rows, _canvas->height())) };
+    BandView view { *_canvas, y0, y1 };
+    _list->replay(view, y0, y1 - 1);
+}
+
+#endif // ADAFRUIT_GFX_HOST_THREADS
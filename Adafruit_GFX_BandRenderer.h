@@ -0,0 +1,96 @@
+/*!
+ * @file Adafruit_GFX_BandRenderer.h
+ *
+ * Part of Adafruit's GFX graphics library. Multi-threaded replay of a
+ * display list into a GFXcanvas16 for host builds (Linux, macOS, Windows),
+ * e.g. to render UI previews or large canvases on a PC.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#pragma once
+
+#include "Adafruit_GFX.h"
+#include "Adafruit_GFX_DisplayList.h"
+#include "Adafruit_GFX_Profile.h"
+
+#if ADAFRUIT_GFX_HOST_THREADS
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+/*!
+ * @brief  Renders a display list into a GFXcanvas16 with a pool of worker
+ *         threads. The canvas is split into horizontal bands (rows at the
+ *         canvas' current rotation); every band gets its own clipped view of
+ *         the pixel buffer and replays the part of the list that touches it.
+ *         Bands never overlap, so the pixel buffer needs no locking, and as
+ *         each pixel sees the same commands in the same order the result is
+ *         identical to GFXdisplayList::replay() on the canvas.
+ *         Bands are distributed evenly over the workers up front; a worker
+ *         that runs out steals bands from the back of another worker's range.
+ */
+class GFXbandRenderer {
+public:
+    /*!
+        @brief    Start the worker threads
+        @param    threads      Number of threads including the calling one, 0 = one per hardware thread
+        @param    band_height  Height of a band in pixels; more bands than threads balance uneven scenes
+    */
+    explicit GFXbandRenderer(uint8_t threads = 0, gfx_coord_t band_height = 32);
+
+    /*!
+        @brief    Stop and join the worker threads
+    */
+    ~GFXbandRenderer();
+
+    GFXbandRenderer(const GFXbandRenderer&) = delete;
+    GFXbandRenderer& operator=(const GFXbandRenderer&) = delete;
+
+    /*!
+        @brief    Replay a display list into a canvas, blocks until all bands are done
+        @param    list    Recorded scene, same size and rotation as the canvas
+        @param    canvas  Canvas to render to
+    */
+    void render(const GFXdisplayList& list, GFXcanvas16& canvas);
+
+    /*!
+        @brief    Get the number of threads rendering, including the calling one
+        @returns  Thread count
+    */
+    uint8_t threads() const {
+        return static_cast<uint8_t>(_queues.size());
+    }
+
+private:
+    /// Range of band indices owned by one worker, packed as front << 16 | back
+    struct alignas(64) Queue {
+        std::atomic<uint32_t> range;
+    };
+
+    void worker(uint8_t index);
+    void run(uint8_t index);
+    int32_t pop(uint8_t index);
+    int32_t steal(uint8_t index);
+    void renderBand(uint16_t band);
+
+    std::vector<Queue> _queues;
+    std::vector<std::thread> _threads;
+    std::mutex _mutex;
+    std::condition_variable _wake;
+    std::condition_variable _done;
+    uint32_t _generation;
+    uint8_t _busy;
+    bool _quit;
+
+    const gfx_coord_t _band_height;
+    gfx_coord_t _rows; ///< Band height used by the current render()
+    const GFXdisplayList* _list;
+    GFXcanvas16* _canvas;
+};
+
+#endif // ADAFRUIT_GFX_HOST_THREADS
@@ -0,0 +1,75 @@
+/*!
+ * @file Adafruit_GFX_BusModel.cpp
+ *
+ * Part of Adafruit's GFX graphics library. Timing model of the SPI bus that
+ * turns the traffic counted by Adafruit_SPITFT into a predicted frame time
+ * on the device, so the bus cost of a change can be judged on the host.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_GFX_BusModel.h"
+
+#if ADAFRUIT_GFX_SPITFT_STATS
+
+namespace {
+
+uint32_t saturate(uint64_t ns) {
+    return ns > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(ns);
+}
+
+/// Print nanoseconds as microseconds with one decimal
+void printTime(Print& out, uint32_t ns) {
+    out.print(ns / 1000);
+    out.print('.');
+    out.print(static_cast<char>('0' + ns / 100 % 10));
+    out.print(" us");
+}
+
+void printLine(Print& out, const char* name, uint32_t ns, uint32_t count, const char* unit) {
+    out.print("  ");
+    out.print(name);
+    out.print(' ');
+    printTime(out, ns);
+    out.print(" (");
+    out.print(count);
+    out.print(unit);
+    out.println(')');
+}
+
+} // namespace
+
+uint32_t GFXbusModel::Breakdown::total() const {
+    return saturate(static_cast<uint64_t>(data) + commands + transactions + toggles + transfers);
+}
+
+GFXbusModel::Breakdown GFXbusModel::predict(const Adafruit_SPITFT::Traffic& traffic) const {
+    const uint64_t byte_ns { 8ULL * 1'000'000'000ULL }; // 8 clocks per byte, divided by the frequency below
+    const uint32_t frequency { _frequency ? _frequency : 1 };
+    const uint32_t data_bytes { traffic.bytes - traffic.commands };
+
+    return {
+        saturate(data_bytes * byte_ns / frequency),
+        saturate(traffic.commands * byte_ns / frequency),
+        saturate(static_cast<uint64_t>(traffic.transactions) * _transaction_ns),
+        saturate((static_cast<uint64_t>(traffic.transactions) + traffic.commands) * 2 * _toggle_ns),
+        saturate(static_cast<uint64_t>(traffic.transfers) * _transfer_ns),
+    };
+}
+
+void GFXbusModel::report(Print& out, const Adafruit_SPITFT::Traffic& traffic) const {
+    const Breakdown b { predict(traffic) };
+
+    out.print("bus time ");
+    printTime(out, b.total());
+    out.print(" at ");
+    out.print(_frequency / 1'000'000);
+    out.println(" MHz");
+    printLine(out, "data          ", b.data, traffic.bytes - traffic.commands, " bytes");
+    printLine(out, "commands      ", b.commands, traffic.commands, " bytes");
+    printLine(out, "transactions  ", b.transactions, traffic.transactions, "");
+    printLine(out, "DC/CS toggles ", b.toggles, 2 * (traffic.transactions + traffic.commands), "");
+    printLine(out, "transfer setup", b.transfers, traffic.transfers, " calls");
+}
+
+#endif // ADAFRUIT_GFX_SPITFT_STATS
@@ -0,0 +1,78 @@
+/*!
+ * @file Adafruit_GFX_BusModel.h
+ *
+ * Part of Adafruit's GFX graphics library. Timing model of the SPI bus that
+ * turns the traffic counted by Adafruit_SPITFT into a predicted frame time
+ * on the device, so the bus cost of a change can be judged on the host.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#pragma once
+
+#include "Adafruit_SPITFT.h"
+
+#if ADAFRUIT_GFX_SPITFT_STATS
+/*!
+ * @brief  Predicts how long a display spends on the bus for some recorded
+ *         traffic: every byte takes 8 clock cycles, every transaction, DC or
+ *         CS toggle and call to the SPI driver adds a fixed cost. The costs
+ *         depend on board, driver and compiler; measure them once on the
+ *         device (e.g. with a logic analyzer) and the model tells what a
+ *         change does to the bus without flashing it. Address windows show
+ *         up as their command and parameter bytes, pixels read back by
+ *         readRGBSpan() (save-under, alpha blending) as data bytes at the
+ *         same clock; panels that only read reliably at a lower clock take
+ *         longer for them.
+ *         Only available with ADAFRUIT_GFX_SPITFT_STATS, which records the
+ *         traffic.
+ */
+class GFXbusModel {
+public:
+    /// Predicted bus time in nanoseconds, each part saturates at 2^32 - 1 (4.2 seconds)
+    struct Breakdown {
+        uint32_t data; ///< Clocking data bytes, i.e. pixels, command parameters and read back
+        uint32_t commands; ///< Clocking out command bytes
+        uint32_t transactions; ///< Overhead of startWrite() / endWrite()
+        uint32_t toggles; ///< DC toggles around commands and CS toggles around transactions
+        uint32_t transfers; ///< Setup of the calls to the SPI driver
+
+        /*!
+            @brief    Get the sum of all parts
+            @returns  Predicted frame time in nanoseconds, saturated
+        */
+        uint32_t total() const;
+    };
+
+    /*!
+        @brief    Create a model of a bus
+        @param    frequency       SPI clock in Hz
+        @param    transaction_ns  Cost of a transaction besides its CS toggles, in ns
+        @param    toggle_ns       Cost of a DC or CS toggle, in ns
+        @param    transfer_ns     Setup cost of one call to the SPI driver (a byte, a word or a block), in ns
+    */
+    GFXbusModel(uint32_t frequency, uint32_t transaction_ns, uint32_t toggle_ns, uint32_t transfer_ns)
+        : _frequency { frequency }, _transaction_ns { transaction_ns }, _toggle_ns { toggle_ns }, _transfer_ns { transfer_ns } {}
+
+    /*!
+        @brief    Predict the bus time of recorded traffic
+        @param    traffic  Traffic of a frame, see Adafruit_SPITFT::traffic()
+        @returns  Predicted time, split by cause
+    */
+    Breakdown predict(const Adafruit_SPITFT::Traffic& traffic) const;
+
+    /*!
+        @brief    Print the predicted bus time of recorded traffic with its breakdown
+        @param    out      Output, e.g. Serial
+        @param    traffic  Traffic of a frame, see Adafruit_SPITFT::traffic()
+    */
+    void report(Print& out, const Adafruit_SPITFT::Traffic& traffic) const;
+
+private:
+    const uint32_t _frequency;
+    const uint32_t _transaction_ns;
+    const uint32_t _toggle_ns;
+    const uint32_t _transfer_ns;
+};
+
+#endif // ADAFRUIT_GFX_SPITFT_STATS
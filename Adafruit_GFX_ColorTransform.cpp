@@ -0,0 +1,58 @@
+/*!
+ * @file Adafruit_GFX_ColorTransform.cpp
+ *
+ * Part of Adafruit's GFX graphics library. Color transforms applied while
+ * pixels are sent to a display, for fades, night-mode dimming and similar
+ * effects without redrawing.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_GFX_ColorTransform.h"
+#include <cmath>
+
+
+GFXcolorTransform::GFXcolorTransform() : _lut {}, _gamma { 1.f }, _fade { 255 }, _invert {}, _grayscale {} {
+    update();
+}
+
+void GFXcolorTransform::setGamma(float gamma) {
+    _gamma = gamma > 0.f ? gamma : 1.f;
+    update();
+}
+
+void GFXcolorTransform::setFade(uint8_t level) {
+    _fade = level;
+    update();
+}
+
+void GFXcolorTransform::setInvert(bool invert) {
+    _invert = invert;
+    update();
+}
+
+void GFXcolorTransform::setGrayscale(bool grayscale) {
+    _grayscale = grayscale;
+}
+
+void GFXcolorTransform::update() {
+    _channels_identity = (_gamma == 1.f) && !_invert && (_fade == 255);
+
+    // Fill a channel table with max + 1 entries, values shifted to the channel's position
+    auto fill = [this](uint16_t* table, uint8_t max, uint8_t shift) {
+        for (uint8_t i { 0 }; i <= max; ++i) {
+            uint32_t v { i };
+            if (_gamma != 1.f) {
+                v = static_cast<uint32_t>(std::pow(static_cast<float>(i) / max, _gamma) * max + .5f);
+            }
+            if (_invert) {
+                v = max - v;
+            }
+            v = (v * _fade + 127) / 255;
+            table[i] = static_cast<uint16_t>(v << shift);
+        }
+    };
+    fill(_red, 31, 11);
+    fill(_green, 63, 5);
+    fill(_blue, 31, 0);
+}
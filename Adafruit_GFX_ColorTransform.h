@@ -0,0 +1,101 @@
+/*!
+ * @file Adafruit_GFX_ColorTransform.h
+ *
+ * Part of Adafruit's GFX graphics library. Color transforms applied while
+ * pixels are sent to a display, for fades, night-mode dimming and similar
+ * effects without redrawing.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#pragma once
+
+#include "Arduino.h"
+
+
+/*!
+ * @brief  Maps 16-bit 5-6-5 colors to 5-6-5 colors. The steps are applied
+ *         in this order: an optional full 565 -> 565 lookup table, grayscale,
+ *         then per channel gamma, invert and fade. The per-channel steps are
+ *         folded into three small tables (256 bytes total) whenever a
+ *         setting changes, so apply() costs three lookups per pixel.
+ *         Pass it to Adafruit_SPITFT::flush() to transform a canvas on its
+ *         way to the display while the canvas itself stays untouched.
+ */
+class GFXcolorTransform {
+public:
+    /*!
+        @brief    Create an identity transform
+    */
+    GFXcolorTransform();
+
+    /*!
+        @brief    Set the gamma exponent applied to each channel, out = in ^ gamma
+        @param    gamma  Exponent, 1 = unchanged, > 1 darkens mid tones
+    */
+    void setGamma(float gamma);
+
+    /*!
+        @brief    Scale all channels, e.g. to fade the screen in or out
+        @param    level  255 = unchanged, 0 = black
+    */
+    void setFade(uint8_t level);
+
+    /*!
+        @brief    Invert all channels, applied before fading so a faded inverted screen still goes to black
+        @param    invert  True to invert
+    */
+    void setInvert(bool invert);
+
+    /*!
+        @brief    Convert colors to gray (ITU-R BT.601 luma) before the per-channel steps
+        @param    grayscale  True to convert
+    */
+    void setGrayscale(bool grayscale);
+
+    /*!
+        @brief    Set a lookup table applied to every color first, e.g. a color-blindness or palette mapping
+        @param    lut  65536 5-6-5 colors indexed by 5-6-5 color (128 KB, usually in flash), nullptr for none
+    */
+    void setLUT(const uint16_t* lut) {
+        _lut = lut;
+    }
+
+    /*!
+        @brief    Query whether the transform leaves all colors unchanged
+        @returns  True for the identity
+    */
+    bool identity() const {
+        return !_lut && !_grayscale && _channels_identity;
+    }
+
+    /*!
+        @brief    Transform a color
+        @param    color  16-bit 5-6-5 color
+        @returns  Transformed 16-bit 5-6-5 color
+    */
+    uint16_t apply(uint16_t color) const {
+        if (_lut) {
+            color = pgm_read_word(&_lut[color]);
+        }
+        if (_grayscale) {
+            // Luma on a 6-bit scale: 0.299 R + 0.587 G + 0.114 B, with R and B doubled to 6 bits
+            const uint8_t y { static_cast<uint8_t>(((color >> 11) * 2 * 77 + ((color >> 5) & 0x3f) * 150 + (color & 0x1f) * 2 * 29 + 128) >> 8) };
+            return _red[y >> 1] | _green[y] | _blue[y >> 1];
+        }
+        return _red[color >> 11] | _green[(color >> 5) & 0x3f] | _blue[color & 0x1f];
+    }
+
+private:
+    void update();
+
+    uint16_t _red[32]; ///< Red channel results, already shifted into place
+    uint16_t _green[64];
+    uint16_t _blue[32];
+    const uint16_t* _lut;
+    float _gamma;
+    uint8_t _fade;
+    bool _invert;
+    bool _grayscale;
+    bool _channels_identity;
+};
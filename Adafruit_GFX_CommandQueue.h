@@ -0,0 +1,505 @@
+/*!
+ * @file Adafruit_GFX_CommandQueue.h
+ *
+ * Part of Adafruit's GFX graphics library. Bounded lock-free queues of draw
+ * commands, so interrupts and other tasks can post display updates without
+ * touching the (non-reentrant) display driver; the render loop drains the
+ * queue and executes the commands in batches.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#pragma once
+
+#include "Adafruit_GFX.h"
+#include "Adafruit_GFX_DisplayList.h"
+
+#include <atomic>
+#include <cstring>
+
+
+/// What a queue does with a command that doesn't fit
+enum class GFXoverflow : uint8_t {
+    DropNewest, ///< Reject the new command
+    DropOldest, ///< Discard the oldest queued command to make room
+    Coalesce, ///< Keep only the latest command per widget id; commands without widget id are rejected when full
+};
+
+namespace gfx_queue {
+
+using Command = GFXdisplayList::Command;
+
+static_assert(sizeof(Command) % 4 == 0, "Command must pack into 32-bit words");
+
+/// Size of a queue entry in 32-bit words, the command plus a tag word
+static constexpr uint8_t WORDS { sizeof(Command) / 4 + 1 };
+
+/// Tag bit for queue entries that only notify about a pending widget mailbox
+static constexpr uint16_t MAILBOX { 0x100 };
+
+/// Command plus tag as 32-bit words, slots are copied word by word with atomic accesses
+struct Packet {
+    uint32_t w[WORDS];
+
+    Packet() = default;
+
+    Packet(const Command& cmd, uint16_t tag) {
+        std::memcpy(w, &cmd, sizeof(cmd));
+        w[WORDS - 1] = tag;
+    }
+
+    Command command() const {
+        Command cmd;
+        std::memcpy(&cmd, w, sizeof(cmd));
+        return cmd;
+    }
+
+    uint16_t tag() const {
+        return static_cast<uint16_t>(w[WORDS - 1]);
+    }
+};
+
+/// Queue slot that can be read while it's overwritten; the reader detects that and discards the copy
+struct Slot {
+    std::atomic<uint32_t> w[WORDS];
+
+    void store(const Packet& p) {
+        for (uint8_t i { 0 }; i < WORDS; ++i) {
+            w[i].store(p.w[i], std::memory_order_relaxed);
+        }
+    }
+
+    Packet load() const {
+        Packet p;
+        for (uint8_t i { 0 }; i < WORDS; ++i) {
+            p.w[i] = w[i].load(std::memory_order_relaxed);
+        }
+        return p;
+    }
+};
+
+/*!
+ * @brief  Latest command per widget id, used by the Coalesce policy. Every
+ *         mailbox is a sequence lock written by the producer of that widget;
+ *         the queue only carries a notification while a mailbox is pending,
+ *         so a widget never occupies more than one queue entry.
+ */
+template <uint8_t WIDGETS>
+class Mailboxes {
+public:
+    static constexpr bool ENABLED { true };
+
+    Mailboxes() : _scan { 0 } {
+        _orphans.store(false, std::memory_order_relaxed);
+        for (auto& box : _boxes) {
+            box.seq.store(0, std::memory_order_relaxed);
+            box.pending.store(false, std::memory_order_relaxed);
+            box.delivered = 0;
+        }
+    }
+
+    /// Store a widget's command, returns true if a notification has to be queued
+    bool write(uint8_t widget, const Command& cmd) {
+        Box& box { _boxes[widget - 1] };
+        const uint32_t seq { box.seq.load(std::memory_order_relaxed) };
+        box.seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        box.data.store(Packet { cmd, widget });
+        box.seq.store(seq + 2, std::memory_order_seq_cst);
+        return !box.pending.exchange(true, std::memory_order_seq_cst);
+    }
+
+    /// The notification couldn't be queued, leave the mailbox pending for rescue()
+    void orphan() {
+        _orphans.store(true, std::memory_order_seq_cst);
+    }
+
+    /// Take the command of a pending widget whose notification got lost, consumer only
+    bool rescue(uint8_t& widget, Command& cmd) {
+        if (!_scan) {
+            if (!_orphans.exchange(false, std::memory_order_seq_cst)) {
+                return false;
+            }
+            _scan = 1;
+        }
+        while (_scan <= WIDGETS) {
+            const uint8_t w { static_cast<uint8_t>(_scan++) };
+            if (_boxes[w - 1].pending.load(std::memory_order_seq_cst) && read(w, cmd)) {
+                widget = w;
+                return true;
+            }
+        }
+        _scan = 0;
+        return false;
+    }
+
+    /// Take a widget's command, returns false if the producer is updating it right now or it was taken already
+    bool read(uint8_t widget, Command& cmd) {
+        Box& box { _boxes[widget - 1] };
+        // Clear the flag first: an update racing with this read queues a new notification
+        box.pending.store(false, std::memory_order_seq_cst);
+        const uint32_t seq { box.seq.load(std::memory_order_seq_cst) };
+        const Packet p { box.data.load() };
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if ((seq & 1) || box.seq.load(std::memory_order_relaxed) != seq) {
+            return false;
+        }
+        // An update finishing between clearing the flag and loading seq is returned now and notified again later
+        if (seq == box.delivered) {
+            return false;
+        }
+        box.delivered = seq;
+        cmd = p.command();
+        return true;
+    }
+
+    static bool valid(uint8_t widget) {
+        return widget && widget <= WIDGETS;
+    }
+
+private:
+    struct Box {
+        std::atomic<uint32_t> seq;
+        Slot data;
+        std::atomic<bool> pending;
+        uint32_t delivered; ///< seq of the last command taken, consumer only
+    };
+
+    Box _boxes[WIDGETS];
+    std::atomic<bool> _orphans; ///< Set if a notification didn't fit into the queue
+    uint16_t _scan; ///< Next widget rescue() looks at, 0 if not scanning
+};
+
+template <>
+class Mailboxes<0> {
+public:
+    static constexpr bool ENABLED { false };
+
+    bool write(uint8_t, const Command&) {
+        return false;
+    }
+
+    void orphan() {}
+
+    bool read(uint8_t, Command&) {
+        return false;
+    }
+
+    bool rescue(uint8_t&, Command&) {
+        return false;
+    }
+
+    static bool valid(uint8_t) {
+        return false;
+    }
+};
+
+/*!
+ * @brief  Producer and consumer interface shared by the queue types. The
+ *         derived queue provides pushPacket() and popPacket().
+ */
+template <typename Queue, uint8_t WIDGETS>
+class QueueBase {
+public:
+    /*!
+        @brief    Queue a command, safe to call from an interrupt. Never blocks.
+        @param    cmd     Command to queue
+        @param    widget  Id of the widget the command belongs to (1 .. WIDGETS for coalescing), 0 for none
+        @returns  false if the command was dropped
+    */
+    bool post(const Command& cmd, uint8_t widget = 0) {
+        if (_policy == GFXoverflow::Coalesce && Mailboxes<WIDGETS>::valid(widget)) {
+            if (!_mailboxes.write(widget, cmd)) {
+                _coalesced.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+            if (!queue().pushPacket(Packet { Command {}, static_cast<uint16_t>(MAILBOX | widget) })) {
+                // Queue is full, the consumer picks the mailbox up once the queue ran empty
+                _mailboxes.orphan();
+            }
+            return true;
+        }
+        if (!queue().pushPacket(Packet { cmd, widget })) {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        return true;
+    }
+
+    /*!
+        @brief    Queue a command, see post(const Command&, uint8_t)
+        @param    op      Operation
+        @param    x       Command x coordinate
+        @param    y       Command y coordinate
+        @param    w       Command width (end point x for lines)
+        @param    h       Command height (end point y for lines)
+        @param    color   16-bit 5-6-5 Color
+        @param    widget  Widget id, 0 for none
+        @returns  false if the command was dropped
+    */
+    bool post(GFXdisplayList::Op op, gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color, uint8_t widget = 0) {
+        return post(Command { op, 255, color, x, y, w, h }, widget);
+    }
+
+    /*!
+        @brief    Take the oldest command out of the queue. Consumer only.
+        @param    cmd     Set to the command
+        @param    widget  Set to the widget id the command was posted with
+        @returns  false if the queue is empty
+    */
+    bool take(Command& cmd, uint8_t& widget) {
+        Packet p;
+        while (queue().popPacket(p)) {
+            widget = static_cast<uint8_t>(p.tag());
+            if (!(p.tag() & MAILBOX)) {
+                cmd = p.command();
+                return true;
+            }
+            if (_mailboxes.read(widget, cmd)) {
+                return true;
+            }
+            // Widget is being updated right now (the producer queues a new notification), or its command was taken already
+        }
+        return _mailboxes.rescue(widget, cmd);
+    }
+
+    /*!
+        @brief    Execute up to max queued commands on a target, inside one startWrite()/endWrite() pair. Consumer only.
+        @param    target  Target to draw to
+        @param    max     Maximum number of commands to execute, bounds the time spent
+        @returns  Number of commands executed
+    */
+    uint16_t drain(Adafruit_GFX& target, uint16_t max = UINT16_MAX) {
+        Command cmd;
+        uint8_t widget;
+        uint16_t n { 0 };
+        target.startWrite();
+        while (n < max && take(cmd, widget)) {
+            GFXdisplayList::execute(target, cmd);
+            ++n;
+        }
+        target.endWrite();
+        return n;
+    }
+
+    /*!
+        @brief    Pass up to max queued commands to a handler, for commands the render loop interprets itself
+                  (e.g. a widget id plus a value in the coordinate fields). Consumer only.
+        @param    handler  Called as handler(const GFXdisplayList::Command&, uint8_t widget)
+        @param    max      Maximum number of commands to handle
+        @returns  Number of commands handled
+    */
+    template <typename F>
+    uint16_t dispatch(F&& handler, uint16_t max = UINT16_MAX) {
+        Command cmd;
+        uint8_t widget;
+        uint16_t n { 0 };
+        while (n < max && take(cmd, widget)) {
+            handler(static_cast<const Command&>(cmd), widget);
+            ++n;
+        }
+        return n;
+    }
+
+    /*!
+        @brief    Get the number of commands lost to overflow, including those discarded by DropOldest
+        @returns  Dropped command count
+    */
+    uint32_t dropped() const {
+        return _dropped.load(std::memory_order_relaxed);
+    }
+
+    /*!
+        @brief    Get the number of widget commands that replaced a pending one (Coalesce policy)
+        @returns  Coalesced command count
+    */
+    uint32_t coalesced() const {
+        return _coalesced.load(std::memory_order_relaxed);
+    }
+
+protected:
+    explicit QueueBase(GFXoverflow policy) : _policy { policy }, _dropped { 0 }, _coalesced { 0 } {}
+
+    /// Count a command discarded by DropOldest
+    void discarded() {
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    const GFXoverflow _policy;
+
+private:
+    Queue& queue() {
+        return *static_cast<Queue*>(this);
+    }
+
+    Mailboxes<WIDGETS> _mailboxes;
+    std::atomic<uint32_t> _dropped;
+    std::atomic<uint32_t> _coalesced;
+};
+
+} // namespace gfx_queue
+
+
+/*!
+ * @brief  Lock-free single-producer/single-consumer ring of draw commands,
+ *         e.g. one interrupt handler or sensor task feeding the render loop.
+ *         post() never loops or blocks. With DropOldest the producer
+ *         advances the consumer's index once with a CAS; a consumer whose
+ *         slot got overwritten meanwhile sees its own CAS fail and retries
+ *         with the next slot, so take() is lock-free, not wait-free: it may
+ *         retry as long as the producer keeps dropping entries. take() also
+ *         skips stale widget notifications of the Coalesce policy.
+ * @tparam N        Capacity, power of two
+ * @tparam WIDGETS  Number of widget mailboxes for the Coalesce policy (ids 1 .. WIDGETS)
+ */
+template <uint16_t N, uint8_t WIDGETS = 0>
+class GFXcommandRing : public gfx_queue::QueueBase<GFXcommandRing<N, WIDGETS>, WIDGETS> {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "Capacity must be a power of two");
+
+    using Base = gfx_queue::QueueBase<GFXcommandRing<N, WIDGETS>, WIDGETS>;
+    friend Base;
+
+public:
+    /*!
+        @brief    Create an empty ring
+        @param    policy  What to do when the ring is full
+    */
+    explicit GFXcommandRing(GFXoverflow policy = GFXoverflow::DropNewest) : Base { policy }, _head { 0 }, _tail { 0 } {}
+
+    /*!
+        @brief    Get the number of queued entries, approximate while producer or consumer are active
+        @returns  Entry count
+    */
+    uint16_t size() const {
+        return static_cast<uint16_t>(_tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire));
+    }
+
+private:
+    bool pushPacket(const gfx_queue::Packet& p) {
+        const uint32_t tail { _tail.load(std::memory_order_relaxed) };
+        uint32_t head { _head.load(std::memory_order_acquire) };
+        if (tail - head >= N) {
+            if (this->_policy != GFXoverflow::DropOldest) {
+                return false;
+            }
+            // If this fails the consumer has just freed a slot
+            if (_head.compare_exchange_strong(head, head + 1, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                this->discarded();
+            }
+        }
+        _slots[tail & (N - 1)].store(p);
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool popPacket(gfx_queue::Packet& p) {
+        uint32_t head { _head.load(std::memory_order_relaxed) };
+        while (head != _tail.load(std::memory_order_acquire)) {
+            p = _slots[head & (N - 1)].load();
+            // Fails only if the producer dropped this entry (and may have overwritten the slot)
+            if (_head.compare_exchange_weak(head, head + 1, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    gfx_queue::Slot _slots[N];
+    std::atomic<uint32_t> _head; ///< Next entry to read, owned by the consumer (and DropOldest)
+    std::atomic<uint32_t> _tail; ///< Next entry to write, owned by the producer
+};
+
+
+/*!
+ * @brief  Bounded lock-free multi-producer/single-consumer queue of draw
+ *         commands, for several tasks and interrupts feeding the render loop.
+ *         Each cell carries a sequence number telling whether it's free or
+ *         filled for the current lap (D. Vyukov's bounded queue), producers
+ *         claim cells with a CAS. A producer that is interrupted while filling
+ *         a cell delays the consumer at that cell, it never blocks other
+ *         producers. DropOldest makes producers consume the oldest cell.
+ *         With Coalesce, each widget id must be updated by one producer only.
+ * @tparam N        Capacity, power of two
+ * @tparam WIDGETS  Number of widget mailboxes for the Coalesce policy (ids 1 .. WIDGETS)
+ */
+template <uint16_t N, uint8_t WIDGETS = 0>
+class GFXcommandQueue : public gfx_queue::QueueBase<GFXcommandQueue<N, WIDGETS>, WIDGETS> {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "Capacity must be a power of two");
+
+    using Base = gfx_queue::QueueBase<GFXcommandQueue<N, WIDGETS>, WIDGETS>;
+    friend Base;
+
+public:
+    /*!
+        @brief    Create an empty queue
+        @param    policy  What to do when the queue is full
+    */
+    explicit GFXcommandQueue(GFXoverflow policy = GFXoverflow::DropNewest) : Base { policy }, _enqueue { 0 }, _dequeue { 0 } {
+        for (uint32_t i { 0 }; i < N; ++i) {
+            _cells[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /*!
+        @brief    Get the number of queued entries, approximate while producers or consumer are active
+        @returns  Entry count
+    */
+    uint16_t size() const {
+        return static_cast<uint16_t>(_enqueue.load(std::memory_order_acquire) - _dequeue.load(std::memory_order_acquire));
+    }
+
+private:
+    bool pushPacket(const gfx_queue::Packet& p) {
+        uint32_t pos { _enqueue.load(std::memory_order_relaxed) };
+        while (true) {
+            Cell& cell { _cells[pos & (N - 1)] };
+            const int32_t diff { static_cast<int32_t>(cell.seq.load(std::memory_order_acquire) - pos) };
+            if (diff == 0) {
+                if (_enqueue.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.packet = p;
+                    cell.seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                // Full
+                gfx_queue::Packet oldest;
+                if (this->_policy != GFXoverflow::DropOldest || !popPacket(oldest)) {
+                    return false;
+                }
+                this->discarded();
+                pos = _enqueue.load(std::memory_order_relaxed);
+            } else {
+                pos = _enqueue.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool popPacket(gfx_queue::Packet& p) {
+        uint32_t pos { _dequeue.load(std::memory_order_relaxed) };
+        while (true) {
+            Cell& cell { _cells[pos & (N - 1)] };
+            const int32_t diff { static_cast<int32_t>(cell.seq.load(std::memory_order_acquire) - (pos + 1)) };
+            if (diff == 0) {
+                if (_dequeue.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    p = cell.packet;
+                    cell.seq.store(pos + N, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                // Empty, or the next cell is still being filled
+                return false;
+            } else {
+                pos = _dequeue.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    struct Cell {
+        std::atomic<uint32_t> seq;
+        gfx_queue::Packet packet;
+    };
+
+    Cell _cells[N];
+    std::atomic<uint32_t> _enqueue;
+    std::atomic<uint32_t> _dequeue;
+};
@@ -0,0 +1,147 @@
+/*!
+ * @file Adafruit_GFX_DisplayList.cpp
+ *
+ * Part of Adafruit's GFX graphics library. A recording target that stores
+ * the low-level drawing calls of a scene so it can be replayed later, onto
+ * another target or several times.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_GFX_DisplayList.h"
+
+#include <algorithm>
+
+
+bool GFXdisplayList::Command::rows(gfx_coord_t& y_min, gfx_coord_t& y_max) const {
+    switch (op) {
+        case Op::Pixel:
+            /* no break */
+        case Op::HLine:
+            /* no break */
+        case Op::AlphaHLine:
+            y_min = y_max = y;
+            return true;
+
+        case Op::VLine:
+            /* no break */
+        case Op::Rect: {
+            // Generic implementations draw y .. y + h - 1 in either direction, SPITFT flips negative heights
+            const gfx_coord_t y2 { static_cast<gfx_coord_t>(y + h - 1) };
+            y_min = std::min(y, y2);
+            y_max = std::max(y, y2);
+            return true;
+        }
+
+        case Op::Line:
+            y_min = std::min(y, h);
+            y_max = std::max(y, h);
+            return true;
+
+        case Op::Screen: break;
+    }
+    return false;
+}
+
+GFXdisplayList::GFXdisplayList(gfx_coord_t w, gfx_coord_t h, uint32_t capacity) : Adafruit_GFX(w, h), _capacity { capacity }, _count {}, _overflow { false } {
+    _commands = new Command[capacity];
+    if (!_commands) {
+        _capacity = 0;
+    }
+}
+
+GFXdisplayList::~GFXdisplayList() {
+    if (_commands) {
+        delete[] _commands;
+    }
+}
+
+void GFXdisplayList::record(Op op, gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color, uint8_t alpha) {
+    if (_count >= _capacity) {
+        _overflow = true;
+        return;
+    }
+    _commands[_count++] = { op, alpha, color, x, y, w, h };
+}
+
+void GFXdisplayList::drawPixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) {
+    record(Op::Pixel, x, y, 1, 1, color);
+}
+
+void GFXdisplayList::writePixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) {
+    record(Op::Pixel, x, y, 1, 1, color);
+}
+
+void GFXdisplayList::writeFillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) {
+    record(Op::Rect, x, y, w, h, color);
+}
+
+void GFXdisplayList::writeFastVLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t h, uint16_t color) {
+    record(Op::VLine, x, y, 1, h, color);
+}
+
+void GFXdisplayList::writeFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) {
+    record(Op::HLine, x, y, w, 1, color);
+}
+
+void GFXdisplayList::writeFastHLineAlpha(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color, uint8_t alpha) {
+    if (alpha) {
+        record(Op::AlphaHLine, x, y, w, 1, color, alpha);
+    }
+}
+
+void GFXdisplayList::writeLine(gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t x1, gfx_coord_t y1, uint16_t color) {
+    record(Op::Line, x0, y0, x1, y1, color);
+}
+
+void GFXdisplayList::drawFastVLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t h, uint16_t color) {
+    record(Op::VLine, x, y, 1, h, color);
+}
+
+void GFXdisplayList::drawFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) {
+    record(Op::HLine, x, y, w, 1, color);
+}
+
+void GFXdisplayList::fillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) {
+    record(Op::Rect, x, y, w, h, color);
+}
+
+void GFXdisplayList::fillScreen(uint16_t color) {
+    record(Op::Screen, 0, 0, _width, _height, color);
+}
+
+void GFXdisplayList::execute(Adafruit_GFX& target, const Command& cmd) {
+    switch (cmd.op) {
+        case Op::Pixel: target.writePixel(cmd.x, cmd.y, cmd.color); break;
+
+        case Op::HLine: target.writeFastHLine(cmd.x, cmd.y, cmd.w, cmd.color); break;
+
+        case Op::VLine: target.writeFastVLine(cmd.x, cmd.y, cmd.h, cmd.color); break;
+
+        case Op::Rect: target.writeFillRect(cmd.x, cmd.y, cmd.w, cmd.h, cmd.color); break;
+
+        case Op::Line: target.writeLine(cmd.x, cmd.y, cmd.w, cmd.h, cmd.color); break;
+
+        case Op::Screen:
+            // fillScreen() is self-contained (drawing-level), don't nest it into the running transaction
+            target.endWrite();
+            target.fillScreen(cmd.color);
+            target.startWrite();
+            break;
+
+        case Op::AlphaHLine: target.writeFastHLineAlpha(cmd.x, cmd.y, cmd.w, cmd.color, cmd.alpha); break;
+    }
+}
+
+void GFXdisplayList::replay(Adafruit_GFX& target, gfx_coord_t y_min, gfx_coord_t y_max) const {
+    target.startWrite();
+    for (uint32_t i { 0 }; i < _count; ++i) {
+        const Command& cmd { _commands[i] };
+        gfx_coord_t top, bottom;
+        if (cmd.rows(top, bottom) && ((bottom < y_min) || (top > y_max))) {
+            continue;
+        }
+        execute(target, cmd);
+    }
+    target.endWrite();
+}
@@ -0,0 +1,146 @@
+/*!
+ * @file Adafruit_GFX_DisplayList.h
+ *
+ * Part of Adafruit's GFX graphics library. A recording target that stores
+ * the low-level drawing calls of a scene so it can be replayed later, onto
+ * another target or several times.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#pragma once
+
+#include "Adafruit_GFX.h"
+
+
+/*!
+ * @brief  Records drawing operations instead of executing them. All
+ *         Adafruit_GFX primitives, text included, end up in the virtual
+ *         pixel/line/rect functions; those calls are stored as compact
+ *         commands in a buffer of fixed capacity and can be replayed onto
+ *         any target with replay(). The recorder has the size of the target
+ *         and must use the same rotation setting, so text wrapping and
+ *         clipping decisions are identical.
+ */
+class GFXdisplayList : public Adafruit_GFX {
+public:
+    /// Recorded operation
+    enum class Op : uint8_t {
+        Pixel, ///< writePixel(x, y, color)
+        HLine, ///< writeFastHLine(x, y, w, color)
+        VLine, ///< writeFastVLine(x, y, h, color)
+        Rect, ///< writeFillRect(x, y, w, h, color)
+        Line, ///< writeLine(x, y, w, h, color), w/h hold the end point
+        Screen, ///< fillScreen(color)
+        AlphaHLine, ///< writeFastHLineAlpha(x, y, w, color, alpha)
+    };
+
+    /// A recorded call, 12 bytes (20 with 32-bit coordinates)
+    struct Command {
+        Op op;
+        uint8_t alpha;
+        uint16_t color;
+        gfx_coord_t x;
+        gfx_coord_t y;
+        gfx_coord_t w;
+        gfx_coord_t h;
+
+        /*!
+            @brief    Get the rows a command may touch
+            @param    y_min  Set to the top-most row
+            @param    y_max  Set to the bottom-most row
+            @returns  false for commands covering the whole target (fillScreen)
+        */
+        bool rows(gfx_coord_t& y_min, gfx_coord_t& y_max) const;
+    };
+
+    /*!
+        @brief    Create an empty display list
+        @param    w         Width of the target, in pixels
+        @param    h         Height of the target, in pixels
+        @param    capacity  Maximum number of commands
+    */
+    GFXdisplayList(gfx_coord_t w, gfx_coord_t h, uint32_t capacity);
+
+    /*!
+        @brief    Delete the display list, free memory
+    */
+    virtual ~GFXdisplayList() override;
+
+    virtual void drawPixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) override;
+    virtual void writePixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) override;
+    virtual void writeFillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) override;
+    virtual void writeFastVLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t h, uint16_t color) override;
+    virtual void writeFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) override;
+    virtual void writeFastHLineAlpha(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color, uint8_t alpha) override;
+    virtual void writeLine(gfx_coord_t x0, gfx_coord_t y0, gfx_coord_t x1, gfx_coord_t y1, uint16_t color) override;
+    virtual void drawFastVLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t h, uint16_t color) override;
+    virtual void drawFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) override;
+    virtual void fillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) override;
+    virtual void fillScreen(uint16_t color) override;
+
+    /*!
+        @brief    Remove all recorded commands
+    */
+    void clear() {
+        _count = 0;
+        _overflow = false;
+    }
+
+    /*!
+        @brief    Execute the recorded commands on a target, inside one startWrite()/endWrite() pair
+        @param    target  Target to draw to, must have the same size and rotation as the recorder
+    */
+    void replay(Adafruit_GFX& target) const {
+        replay(target, GFX_COORD_MIN, GFX_COORD_MAX);
+    }
+
+    /*!
+        @brief    Execute the recorded commands that may touch the rows y_min to y_max. Used to render a
+                  horizontal band of the target; the target is responsible for clipping to the band.
+        @param    target  Target to draw to, must have the same size and rotation as the recorder
+        @param    y_min   Top-most row of interest
+        @param    y_max   Bottom-most row of interest
+    */
+    void replay(Adafruit_GFX& target, gfx_coord_t y_min, gfx_coord_t y_max) const;
+
+    /*!
+        @brief    Execute a single command. Must be called between startWrite() and endWrite().
+        @param    target  Target to draw to
+        @param    cmd     Command to execute
+    */
+    static void execute(Adafruit_GFX& target, const Command& cmd);
+
+    /*!
+        @brief    Get the number of recorded commands
+        @returns  Command count
+    */
+    uint32_t size() const {
+        return _count;
+    }
+
+    /*!
+        @brief    Access a recorded command
+        @param    i  Index, less than size()
+        @returns  The command
+    */
+    const Command& operator[](uint32_t i) const {
+        return _commands[i];
+    }
+
+    /*!
+        @brief    Query whether commands were dropped because the capacity was exceeded
+        @returns  True if the list is incomplete
+    */
+    bool overflowed() const {
+        return _overflow;
+    }
+
+private:
+    void record(Op op, gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color, uint8_t alpha = 255);
+
+    Command* _commands;
+    uint32_t _capacity;
+    uint32_t _count;
+    bool _overflow;
+};
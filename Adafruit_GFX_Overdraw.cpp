@@ -0,0 +1,205 @@
+/*!
+ * @file Adafruit_GFX_Overdraw.cpp
+ *
+ * Part of Adafruit's GFX graphics library. Debug target that counts how
+ * often every pixel is written, to find screens that draw pixels several
+ * times per frame.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_GFX_Overdraw.h"
+
+#if ADAFRUIT_GFX_OVERDRAW
+#include <algorithm>
+#include <cstring>
+
+
+constexpr uint8_t GFXoverdrawProbe::MAX_LABELS;
+
+GFXoverdrawProbe::GFXoverdrawProbe(Adafruit_GFX& target)
+    : Adafruit_GFX(target.width(), target.height()), _target { target }, _label {}, _written {}, _overdraw {}, _maximum {}, _stats_used {}, _stats {} {
+    _counts = new uint8_t[static_cast<size_t>(WIDTH) * HEIGHT];
+    reset();
+}
+
+GFXoverdrawProbe::~GFXoverdrawProbe() {
+    delete[] _counts;
+}
+
+void GFXoverdrawProbe::reset() {
+    if (_counts) {
+        std::memset(_counts, 0, static_cast<size_t>(WIDTH) * HEIGHT);
+    }
+    _label = nullptr;
+    _written = _overdraw = 0;
+    _maximum = 0;
+    _stats_used = 0;
+}
+
+uint8_t GFXoverdrawProbe::count(gfx_coord_t x, gfx_coord_t y) const {
+    if (!_counts || (x < 0) || (y < 0) || (x >= WIDTH) || (y >= HEIGHT)) {
+        return 0;
+    }
+    return _counts[x + static_cast<size_t>(y) * WIDTH];
+}
+
+void GFXoverdrawProbe::count(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, Kind kind) {
+    static const char* const kinds[] { "pixel", "hline", "vline", "rect", "alpha hline", "bitmap" };
+
+    const int32_t x2 { std::min<int32_t>(x + w, WIDTH) }, y2 { std::min<int32_t>(y + h, HEIGHT) };
+    const int32_t x1 { std::max<int32_t>(x, 0) }, y1 { std::max<int32_t>(y, 0) };
+    if (!_counts || (x1 >= x2) || (y1 >= y2)) {
+        return;
+    }
+
+    uint32_t written { 0 }, overdraw { 0 };
+    for (int32_t row { y1 }; row < y2; ++row) {
+        uint8_t* p { _counts + static_cast<size_t>(row) * WIDTH + x1 };
+        for (int32_t i { x1 }; i < x2; ++i, ++p) {
+            overdraw += *p != 0;
+            if (*p < 255) {
+                ++*p;
+            }
+            _maximum = std::max(_maximum, *p);
+        }
+        written += x2 - x1;
+    }
+    _written += written;
+    _overdraw += overdraw;
+
+    // Labels are compared by address, they are meant to be string literals
+    const char* name { _label ? _label : kinds[static_cast<uint8_t>(kind)] };
+    uint8_t i { 0 };
+    while (i < _stats_used && _stats[i].name != name) {
+        ++i;
+    }
+    if (i == _stats_used) {
+        if (_stats_used == MAX_LABELS) {
+            return;
+        }
+        _stats[_stats_used++] = { name, 0, 0 };
+    }
+    _stats[i].written += written;
+    _stats[i].overdraw += overdraw;
+}
+
+void GFXoverdrawProbe::report(Print& out, uint8_t top) const {
+    out.print("overdraw: ");
+    out.print(_overdraw);
+    out.print(" of ");
+    out.print(_written);
+    out.print(" pixel writes, max ");
+    out.print(_maximum);
+    out.println(" writes per pixel");
+
+    // Selection of the worst entries, the table is tiny
+    bool shown[MAX_LABELS] {};
+    for (uint8_t n { 0 }; n < std::min(top, _stats_used); ++n) {
+        int16_t worst { -1 };
+        for (uint8_t i { 0 }; i < _stats_used; ++i) {
+            if (!shown[i] && (worst < 0 || _stats[i].overdraw > _stats[worst].overdraw)) {
+                worst = i;
+            }
+        }
+        shown[worst] = true;
+        out.print("  ");
+        out.print(_stats[worst].name);
+        out.print(": ");
+        out.print(_stats[worst].overdraw);
+        out.print(" of ");
+        out.println(_stats[worst].written);
+    }
+}
+
+void GFXoverdrawProbe::heatmap(GFXcanvas16& canvas) const {
+    static constexpr uint16_t colors[] { 0x0000, 0x0010, 0x07e0, 0xffe0, 0xfd20, 0xf800 };
+
+    canvas.startWrite();
+    for (gfx_coord_t y { 0 }; y < HEIGHT; ++y) {
+        for (gfx_coord_t x { 0 }; x < WIDTH; ++x) {
+            canvas.writePixel(x, y, colors[std::min<uint8_t>(count(x, y), 5)]);
+        }
+    }
+    canvas.endWrite();
+}
+
+void GFXoverdrawProbe::drawPixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) {
+    count(x, y, 1, 1, Kind::Pixel);
+    _target.drawPixel(x, y, color);
+}
+
+void GFXoverdrawProbe::writePixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) {
+    count(x, y, 1, 1, Kind::Pixel);
+    _target.writePixel(x, y, color);
+}
+
+void GFXoverdrawProbe::writeFillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) {
+    if ((w > 0) && (h > 0)) {
+        count(x, y, w, h, Kind::Rect);
+    }
+    _target.writeFillRect(x, y, w, h, color);
+}
+
+void GFXoverdrawProbe::writeFastVLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t h, uint16_t color) {
+    if (h > 0) {
+        count(x, y, 1, h, Kind::VLine);
+    }
+    _target.writeFastVLine(x, y, h, color);
+}
+
+void GFXoverdrawProbe::writeFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) {
+    if (w > 0) {
+        count(x, y, w, 1, Kind::HLine);
+    }
+    _target.writeFastHLine(x, y, w, color);
+}
+
+void GFXoverdrawProbe::writeFastHLineAlpha(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color, uint8_t alpha) {
+    if ((w > 0) && alpha) {
+        count(x, y, w, 1, Kind::AlphaHLine);
+    }
+    _target.writeFastHLineAlpha(x, y, w, color, alpha);
+}
+
+void GFXoverdrawProbe::drawFastVLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t h, uint16_t color) {
+    if (h > 0) {
+        count(x, y, 1, h, Kind::VLine);
+    }
+    _target.drawFastVLine(x, y, h, color);
+}
+
+void GFXoverdrawProbe::drawFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) {
+    if (w > 0) {
+        count(x, y, w, 1, Kind::HLine);
+    }
+    _target.drawFastHLine(x, y, w, color);
+}
+
+void GFXoverdrawProbe::fillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) {
+    if ((w > 0) && (h > 0)) {
+        count(x, y, w, h, Kind::Rect);
+    }
+    _target.fillRect(x, y, w, h, color);
+}
+
+void GFXoverdrawProbe::fillScreen(uint16_t color) {
+    count(0, 0, _width, _height, Kind::Rect);
+    _target.fillScreen(color);
+}
+
+void GFXoverdrawProbe::writeRGBSpan(gfx_coord_t x, gfx_coord_t y, const uint16_t colors[], gfx_coord_t w) {
+    if (w > 0) {
+        count(x, y, w, 1, Kind::Bitmap);
+    }
+    _target.writeRGBSpan(x, y, colors, w);
+}
+
+void GFXoverdrawProbe::drawRGBBitmap(gfx_coord_t x, gfx_coord_t y, uint16_t* bitmap, gfx_coord_t w, gfx_coord_t h) {
+    if ((w > 0) && (h > 0)) {
+        count(x, y, w, h, Kind::Bitmap);
+    }
+    _target.drawRGBBitmap(x, y, bitmap, w, h);
+}
+
+#endif // ADAFRUIT_GFX_OVERDRAW
@@ -0,0 +1,206 @@
+/*!
+ * @file Adafruit_GFX_Overdraw.h
+ *
+ * Part of Adafruit's GFX graphics library. Debug target that counts how
+ * often every pixel is written, to find screens that draw pixels several
+ * times per frame.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#pragma once
+
+#include "Adafruit_GFX.h"
+
+#ifndef ADAFRUIT_GFX_OVERDRAW
+#define ADAFRUIT_GFX_OVERDRAW 0 ///< Set to 1 to count pixel writes, 0 makes GFXoverdrawProbe a plain reference to the target
+#endif
+
+
+#if ADAFRUIT_GFX_OVERDRAW
+/*!
+ * @brief  Forwards all drawing to another target and counts the writes of
+ *         every pixel in a side buffer of 8-bit saturating counters, one
+ *         byte per pixel. Draw through gfx() and call reset() at the start
+ *         of a frame; at its end overdraw() tells how many pixel writes
+ *         were redundant, report() lists the worst primitives and heatmap()
+ *         shows where they happened.
+ *         Writes are accounted to the label set with label(), or to the
+ *         kind of low-level call (pixel, line, rect, bitmap) if there is
+ *         none. Calls with sizes that aren't positive are forwarded
+ *         unchanged but not counted.
+ *         Build with ADAFRUIT_GFX_OVERDRAW 0 and gfx() returns the target
+ *         itself, all other functions do nothing and no memory is used.
+ */
+class GFXoverdrawProbe : public Adafruit_GFX {
+public:
+    static constexpr uint8_t MAX_LABELS { 16 }; ///< Number of labels and call kinds kept in the statistics
+
+    /*!
+        @brief    Create a probe with the size of the target at its current rotation
+        @param    target  Target to draw to
+    */
+    explicit GFXoverdrawProbe(Adafruit_GFX& target);
+
+    /*!
+        @brief    Delete the probe, free memory
+    */
+    virtual ~GFXoverdrawProbe() override;
+
+    GFXoverdrawProbe(const GFXoverdrawProbe&) = delete;
+    GFXoverdrawProbe& operator=(const GFXoverdrawProbe&) = delete;
+
+    /*!
+        @brief    Get the target to draw to
+        @returns  The probe itself
+    */
+    Adafruit_GFX& gfx() {
+        return *this;
+    }
+
+    /*!
+        @brief    Clear all counts and statistics, e.g. at the start of a frame
+    */
+    void reset();
+
+    /*!
+        @brief    Account subsequent writes to a label, e.g. the name of a widget
+        @param    name  Label, must stay valid until reset(); nullptr to account by call kind again
+    */
+    void label(const char* name) {
+        _label = name;
+    }
+
+    /*!
+        @brief    Get the number of pixel writes since reset()
+        @returns  Pixel writes
+    */
+    uint32_t written() const {
+        return _written;
+    }
+
+    /*!
+        @brief    Get the number of writes to pixels that were already written since reset()
+        @returns  Redundant pixel writes
+    */
+    uint32_t overdraw() const {
+        return _overdraw;
+    }
+
+    /*!
+        @brief    Get the highest write count of a pixel since reset()
+        @returns  Maximum count, saturates at 255
+    */
+    uint8_t maximum() const {
+        return _maximum;
+    }
+
+    /*!
+        @brief    Get the write count of a pixel since reset()
+        @param    x   x coordinate
+        @param    y   y coordinate
+        @returns  Count, 0 if outside of the target
+    */
+    uint8_t count(gfx_coord_t x, gfx_coord_t y) const;
+
+    /*!
+        @brief    Print totals and the labels or call kinds with the most overdraw
+        @param    out  Output, e.g. Serial
+        @param    top  Number of entries to list
+    */
+    void report(Print& out, uint8_t top = 5) const;
+
+    /*!
+        @brief    Draw the counts as a heatmap: not written black, written once dark blue, then
+                  green, yellow, orange and red for 5 or more writes
+        @param    canvas  Canvas to draw to, same size as the probe
+    */
+    void heatmap(GFXcanvas16& canvas) const;
+
+    virtual void startWrite() override {
+        _target.startWrite();
+    }
+
+    virtual void endWrite() override {
+        _target.endWrite();
+    }
+
+    virtual void drawPixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) override;
+    virtual void writePixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) override;
+    virtual void writeFillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) override;
+    virtual void writeFastVLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t h, uint16_t color) override;
+    virtual void writeFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) override;
+    virtual void writeFastHLineAlpha(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color, uint8_t alpha) override;
+    virtual void drawFastVLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t h, uint16_t color) override;
+    virtual void drawFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) override;
+    virtual void fillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) override;
+    virtual void fillScreen(uint16_t color) override;
+    virtual void writeRGBSpan(gfx_coord_t x, gfx_coord_t y, const uint16_t colors[], gfx_coord_t w) override;
+
+    using Adafruit_GFX::drawRGBBitmap;
+    virtual void drawRGBBitmap(gfx_coord_t x, gfx_coord_t y, uint16_t* bitmap, gfx_coord_t w, gfx_coord_t h) override;
+
+private:
+    /// Kind of low-level call, used as label if none is set
+    enum class Kind : uint8_t { Pixel, HLine, VLine, Rect, AlphaHLine, Bitmap };
+
+    struct Stat {
+        const char* name;
+        uint32_t written;
+        uint32_t overdraw;
+    };
+
+    /// Count the writes of a rectangle with positive size, clipped to the probe
+    void count(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, Kind kind);
+
+    Adafruit_GFX& _target;
+    uint8_t* _counts;
+    const char* _label;
+    uint32_t _written;
+    uint32_t _overdraw;
+    uint8_t _maximum;
+    uint8_t _stats_used;
+    Stat _stats[MAX_LABELS];
+};
+
+#else
+/*!
+ * @brief  Disabled overdraw probe, see ADAFRUIT_GFX_OVERDRAW. gfx() returns
+ *         the target itself, so drawing costs exactly the same as without
+ *         the probe.
+ */
+class GFXoverdrawProbe {
+public:
+    explicit GFXoverdrawProbe(Adafruit_GFX& target) : _target { target } {}
+
+    Adafruit_GFX& gfx() {
+        return _target;
+    }
+
+    void reset() {}
+    void label(const char*) {}
+
+    uint32_t written() const {
+        return 0;
+    }
+
+    uint32_t overdraw() const {
+        return 0;
+    }
+
+    uint8_t maximum() const {
+        return 0;
+    }
+
+    uint8_t count(gfx_coord_t, gfx_coord_t) const {
+        return 0;
+    }
+
+    void report(Print&, uint8_t = 5) const {}
+    void heatmap(GFXcanvas16&) const {}
+
+private:
+    Adafruit_GFX& _target;
+};
+
+#endif // ADAFRUIT_GFX_OVERDRAW
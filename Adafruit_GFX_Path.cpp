@@ -0,0 +1,263 @@
+/*!
+ * @file Adafruit_GFX_Path.cpp
+ *
+ * Part of Adafruit's GFX graphics library. Vector outlines made of lines
+ * and Bezier curves, filled with an anti-aliased scanline rasterizer.
+ *
+ * The rasterizer walks the path's bounding box one pixel row at a time. Each
+ * row is sampled at SUBSAMPLES sub-scanlines; on every sub-scanline the edge
+ * crossings are sorted and the fill rule decides which intervals are inside.
+ * Inside intervals are accumulated with exact horizontal coverage into one
+ * row of accumulators (partial area of the end pixels plus a running cover
+ * delta for the pixels in between), so the cost per interval doesn't depend
+ * on its length. The finished row is converted to alpha and written as spans
+ * of equal coverage, i.e. the interior of a shape becomes long solid spans.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_GFX_Path.h"
+#include "Adafruit_GFX_Profile.h"
+#include "gfxbezier.h"
+
+#include <algorithm>
+#include <cstring>
+
+
+namespace {
+
+/// Non-horizontal edge in device space, 24.8 fixed point
+struct Edge {
+    int32_t y_top;
+    int32_t y_bottom; ///< exclusive
+    int32_t x_top; ///< x at y_top
+    int32_t slope; ///< dx/dy in 16.16 fixed point
+    int8_t dir; ///< +1 downwards, -1 upwards
+};
+
+/// Edge crossing of one sub-scanline
+struct Crossing {
+    int32_t x;
+    int8_t dir;
+};
+
+} // namespace
+
+
+GFXpath::GFXpath(uint16_t max_vertices) : _capacity { max_vertices }, _count {}, _contour {}, _overflow { false } {
+    _vertices = new Vertex[max_vertices];
+    if (!_vertices) {
+        _capacity = 0;
+    }
+}
+
+GFXpath::~GFXpath() {
+    if (_vertices) {
+        delete[] _vertices;
+    }
+}
+
+void GFXpath::clear() {
+    _count = 0;
+    _contour = 0;
+    _overflow = false;
+}
+
+void GFXpath::addVertex(int32_t x, int32_t y, bool move) {
+    if (_count >= _capacity) {
+        _overflow = true;
+        return;
+    }
+    if (move) {
+        _contour = _count;
+    }
+    _vertices[_count++] = { x, y, move };
+}
+
+void GFXpath::moveTo(int16_t x, int16_t y) {
+    addVertex(x * 256, y * 256, true);
+}
+
+void GFXpath::lineTo(int16_t x, int16_t y) {
+    addVertex(x * 256, y * 256, _count == 0);
+}
+
+void GFXpath::quadTo(int16_t cx, int16_t cy, int16_t x, int16_t y) {
+    if (_count == 0) {
+        moveTo(cx, cy);
+    }
+    if (_count == 0) { // No room for the start point, no previous vertex to start from
+        _overflow = true;
+        return;
+    }
+    const Vertex& p { _vertices[_count - 1] };
+    gfx_bezier::flattenQuad(p.x, p.y, cx * 256, cy * 256, x * 256, y * 256, [this](int32_t fx, int32_t fy) { addVertex(fx, fy, false); });
+}
+
+void GFXpath::curveTo(int16_t cx1, int16_t cy1, int16_t cx2, int16_t cy2, int16_t x, int16_t y) {
+    if (_count == 0) {
+        moveTo(cx1, cy1);
+    }
+    if (_count == 0) { // No room for the start point, no previous vertex to start from
+        _overflow = true;
+        return;
+    }
+    const Vertex& p { _vertices[_count - 1] };
+    gfx_bezier::flattenCubic(
+        p.x, p.y, cx1 * 256, cy1 * 256, cx2 * 256, cy2 * 256, x * 256, y * 256, [this](int32_t fx, int32_t fy) { addVertex(fx, fy, false); });
+}
+
+void GFXpath::close() {
+    if (_count > _contour + 1) {
+        // Start a new (so far empty) contour at the first point of this one
+        const Vertex start { _vertices[_contour] };
+        addVertex(start.x, start.y, true);
+    }
+}
+
+bool GFXpath::fill(Adafruit_GFX& gfx, gfx_coord_t x, gfx_coord_t y, uint16_t color, FillRule rule, uint16_t scale) const {
+    GFX_PROFILE_FUNCTION();
+    if (_count < 3) {
+        return true;
+    }
+
+    Edge* edges { new Edge[_count] };
+    Crossing* crossings { new Crossing[_count] };
+    if (!edges || !crossings) {
+        delete[] edges;
+        delete[] crossings;
+        return false;
+    }
+
+    // Transform to device space and build the edge table
+    auto device = [scale](int32_t v, gfx_coord_t origin) -> int32_t { return origin * 256 + static_cast<int32_t>((static_cast<int64_t>(v) * scale) >> 8); };
+    int32_t min_x { INT32_MAX }, min_y { INT32_MAX }, max_x { INT32_MIN }, max_y { INT32_MIN };
+    uint16_t num_edges { 0 };
+    for (uint16_t start { 0 }; start < _count;) {
+        uint16_t end { static_cast<uint16_t>(start + 1) };
+        while (end < _count && !_vertices[end].move) {
+            ++end;
+        }
+        for (uint16_t i { start }; i < end; ++i) {
+            const Vertex& a { _vertices[i] };
+            const Vertex& b { _vertices[(i + 1 < end) ? i + 1 : start] }; // contours are always closed
+            int32_t x0 { device(a.x, x) }, y0 { device(a.y, y) };
+            int32_t x1 { device(b.x, x) }, y1 { device(b.y, y) };
+            min_x = std::min(min_x, x0);
+            max_x = std::max(max_x, x0);
+            min_y = std::min(min_y, y0);
+            max_y = std::max(max_y, y0);
+            if (y0 == y1) {
+                continue;
+            }
+            int8_t dir { 1 };
+            if (y0 > y1) {
+                std::swap(x0, x1);
+                std::swap(y0, y1);
+                dir = -1;
+            }
+            edges[num_edges++] = { y0, y1, x0, static_cast<int32_t>((static_cast<int64_t>(x1 - x0) * 65536) / (y1 - y0)), dir };
+        }
+        start = end;
+    }
+
+    // Pixel area covered by the path, clipped to the target
+    const gfx_coord_t px0 { static_cast<gfx_coord_t>(std::max<int32_t>(min_x >> 8, 0)) };
+    const gfx_coord_t px1 { static_cast<gfx_coord_t>(std::min<int32_t>((max_x + 255) >> 8, gfx.width())) }; // exclusive
+    const gfx_coord_t py0 { static_cast<gfx_coord_t>(std::max<int32_t>(min_y >> 8, 0)) };
+    const gfx_coord_t py1 { static_cast<gfx_coord_t>(std::min<int32_t>((max_y + 255) >> 8, gfx.height())) }; // exclusive
+    if (px0 >= px1 || py0 >= py1 || !num_edges) {
+        delete[] edges;
+        delete[] crossings;
+        return true;
+    }
+
+    // One coverage row: partial area of edge pixels, and the cover delta for pixels fully between crossings
+    const gfx_coord_t width { static_cast<gfx_coord_t>(px1 - px0) };
+    int32_t* area { new int32_t[2 * width + 1] };
+    if (!area) {
+        delete[] edges;
+        delete[] crossings;
+        return false;
+    }
+    int32_t* cover { area + width };
+    std::memset(area, 0, (2 * width + 1) * sizeof(int32_t));
+
+    const int32_t clip_left { px0 * 256 };
+    const int32_t clip_right { px1 * 256 };
+
+    gfx.startWrite();
+    for (gfx_coord_t row { py0 }; row < py1; ++row) {
+        for (uint8_t s { 0 }; s < SUBSAMPLES; ++s) {
+            const int32_t sy { row * 256 + (s * 256 + 128) / SUBSAMPLES };
+
+            uint16_t n { 0 };
+            for (uint16_t e { 0 }; e < num_edges; ++e) {
+                const Edge& edge { edges[e] };
+                if (sy >= edge.y_top && sy < edge.y_bottom) {
+                    const int32_t cx { edge.x_top + static_cast<int32_t>((static_cast<int64_t>(sy - edge.y_top) * edge.slope) >> 16) };
+                    // Insertion sort, there are only a few crossings per sub-scanline
+                    uint16_t k { n++ };
+                    while (k > 0 && crossings[k - 1].x > cx) {
+                        crossings[k] = crossings[k - 1];
+                        --k;
+                    }
+                    crossings[k] = { cx, edge.dir };
+                }
+            }
+
+            int16_t winding { 0 };
+            for (uint16_t k { 0 }; k + 1 < n; ++k) {
+                winding += crossings[k].dir;
+                const bool inside { rule == FillRule::NonZero ? winding != 0 : (winding & 1) != 0 };
+                if (!inside) {
+                    continue;
+                }
+
+                const int32_t a { std::max(crossings[k].x, clip_left) - clip_left };
+                const int32_t b { std::min(crossings[k + 1].x, clip_right) - clip_left };
+                if (a >= b) {
+                    continue;
+                }
+                const gfx_coord_t ia { static_cast<gfx_coord_t>(a >> 8) };
+                const gfx_coord_t ib { static_cast<gfx_coord_t>(b >> 8) };
+                if (ia == ib) {
+                    area[ia] += b - a;
+                } else {
+                    area[ia] += 256 - (a & 255);
+                    cover[ia + 1] += 256;
+                    cover[ib] -= 256;
+                    if (ib < width) {
+                        area[ib] += b & 255;
+                    }
+                }
+            }
+        }
+
+        // Resolve the row into spans of equal alpha
+        int32_t running { 0 };
+        gfx_coord_t span_start { 0 };
+        uint8_t span_alpha { 0 };
+        for (gfx_coord_t i { 0 }; i <= width; ++i) {
+            uint8_t alpha { 0 };
+            if (i < width) {
+                running += cover[i];
+                alpha = static_cast<uint8_t>(std::min<int32_t>((running + area[i]) / SUBSAMPLES, 255));
+            }
+            if (alpha != span_alpha) {
+                if (span_alpha) {
+                    gfx.writeFastHLineAlpha(px0 + span_start, row, i - span_start, color, span_alpha);
+                }
+                span_start = i;
+                span_alpha = alpha;
+            }
+        }
+        std::memset(area, 0, (2 * width + 1) * sizeof(int32_t));
+    }
+    gfx.endWrite();
+
+    delete[] area;
+    delete[] edges;
+    delete[] crossings;
+    return true;
+}
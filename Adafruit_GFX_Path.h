@@ -0,0 +1,138 @@
+/*!
+ * @file Adafruit_GFX_Path.h
+ *
+ * Part of Adafruit's GFX graphics library. Vector outlines made of lines
+ * and Bezier curves, filled with an anti-aliased scanline rasterizer.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#pragma once
+
+#include "Adafruit_GFX.h"
+
+
+/*!
+ * @brief  A vector outline made of one or more closed contours of lines and
+ *         quadratic/cubic Bezier curves. Coordinates are integer path units,
+ *         fill() maps them to pixels with a scale and an offset, so one path
+ *         serves every icon size.
+ *         Curves are flattened into line vertices when they're added, the
+ *         vertex storage is allocated once with the capacity given to the
+ *         constructor. Filling needs one coverage row plus a small edge table,
+ *         independent of the size of the filled area.
+ */
+class GFXpath {
+public:
+    /// Rule to decide which areas enclosed by the contours are inside
+    enum class FillRule : uint8_t {
+        NonZero, ///< Inside if the contours wind around a point in total (SVG/PostScript default)
+        EvenOdd, ///< Inside if a ray from a point crosses an odd number of edges
+    };
+
+    /*!
+        @brief    Create an empty path
+        @param    max_vertices  Capacity in line vertices; every curve adds up to 1024, typically a few dozen
+    */
+    explicit GFXpath(uint16_t max_vertices);
+
+    /*!
+        @brief    Delete the path, free memory
+    */
+    ~GFXpath();
+
+    GFXpath(const GFXpath&) = delete;
+    GFXpath& operator=(const GFXpath&) = delete;
+
+    /*!
+        @brief    Remove all contours
+    */
+    void clear();
+
+    /*!
+        @brief    Start a new contour, the current one is closed implicitly
+        @param    x   x coordinate in path units
+        @param    y   y coordinate in path units
+    */
+    void moveTo(int16_t x, int16_t y);
+
+    /*!
+        @brief    Add a straight line from the current point
+        @param    x   End point x coordinate in path units
+        @param    y   End point y coordinate in path units
+    */
+    void lineTo(int16_t x, int16_t y);
+
+    /*!
+        @brief    Add a quadratic Bezier curve from the current point
+        @param    cx  Control point x coordinate in path units
+        @param    cy  Control point y coordinate in path units
+        @param    x   End point x coordinate in path units
+        @param    y   End point y coordinate in path units
+    */
+    void quadTo(int16_t cx, int16_t cy, int16_t x, int16_t y);
+
+    /*!
+        @brief    Add a cubic Bezier curve from the current point
+        @param    cx1 First control point x coordinate in path units
+        @param    cy1 First control point y coordinate in path units
+        @param    cx2 Second control point x coordinate in path units
+        @param    cy2 Second control point y coordinate in path units
+        @param    x   End point x coordinate in path units
+        @param    y   End point y coordinate in path units
+    */
+    void curveTo(int16_t cx1, int16_t cy1, int16_t cx2, int16_t cy2, int16_t x, int16_t y);
+
+    /*!
+        @brief    Close the current contour. Contours are always filled as closed, this only ends the contour
+                  so the next lineTo() starts at the contour's first point again.
+    */
+    void close();
+
+    /*!
+        @brief    Fill the path. Coverage is written as spans with alpha through writeFastHLineAlpha(),
+                  so canvases blend the edges and other targets get solid spans.
+        @param    gfx    Target to draw to
+        @param    x      Pixel position of the path origin, x coordinate
+        @param    y      Pixel position of the path origin, y coordinate
+        @param    color  16-bit 5-6-5 Color to fill with
+        @param    rule   Fill rule for overlapping contours
+        @param    scale  Pixels per path unit in 8.8 fixed point (256 = 1:1, 128 = half size)
+        @returns  false if there wasn't enough memory for the coverage row or edge table
+    */
+    bool fill(Adafruit_GFX& gfx, gfx_coord_t x, gfx_coord_t y, uint16_t color, FillRule rule = FillRule::NonZero, uint16_t scale = 256) const;
+
+    /*!
+        @brief    Query whether vertices were dropped because the capacity was exceeded
+        @returns  True if the path is incomplete
+    */
+    bool overflowed() const {
+        return _overflow;
+    }
+
+    /*!
+        @brief    Number of line vertices in the path
+        @returns  Vertex count
+    */
+    uint16_t size() const {
+        return _count;
+    }
+
+    static constexpr uint8_t SUBSAMPLES { 8 }; ///< Sub-scanlines per pixel row used for vertical anti-aliasing
+
+private:
+    /// Flattened vertex in 24.8 fixed point path units
+    struct Vertex {
+        int32_t x;
+        int32_t y;
+        bool move; ///< First vertex of a contour
+    };
+
+    void addVertex(int32_t x, int32_t y, bool move);
+
+    Vertex* _vertices;
+    uint16_t _capacity;
+    uint16_t _count;
+    uint16_t _contour; ///< Index of the first vertex of the current contour
+    bool _overflow;
+};
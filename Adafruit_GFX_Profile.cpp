@@ -0,0 +1,66 @@
+/*!
+ * @file Adafruit_GFX_Profile.cpp
+ *
+ * Part of Adafruit's GFX graphics library. Scoped profiling zones recorded
+ * into a ring buffer and exported as Chrome trace events, to see which
+ * widget or primitive costs what.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_GFX_Profile.h"
+
+#if ADAFRUIT_GFX_PROFILE
+
+GFXprofiler::Slot GFXprofiler::_events[ADAFRUIT_GFX_PROFILE_EVENTS];
+#if ADAFRUIT_GFX_HOST_THREADS
+std::atomic<uint32_t> GFXprofiler::_head { 0 };
+#else
+uint32_t GFXprofiler::_head;
+#endif
+
+namespace {
+
+/// Print a tick count in microseconds, with three decimals if the clock is finer
+void printTime(Print& out, uint32_t ticks) {
+    out.print(ticks / ADAFRUIT_GFX_PROFILE_TICKS_PER_US);
+    if (ADAFRUIT_GFX_PROFILE_TICKS_PER_US > 1) {
+        const uint32_t frac { (ticks % ADAFRUIT_GFX_PROFILE_TICKS_PER_US) * 1000 / ADAFRUIT_GFX_PROFILE_TICKS_PER_US };
+        out.print('.');
+        out.print(static_cast<char>('0' + frac / 100));
+        out.print(static_cast<char>('0' + frac / 10 % 10));
+        out.print(static_cast<char>('0' + frac % 10));
+    }
+}
+
+} // namespace
+
+void GFXprofiler::exportTrace(Print& out) {
+    const uint32_t count { size() };
+    const uint32_t first { _head - count };
+
+    // Zones end in order of their exit, the oldest entry of the buffer isn't necessarily the earliest start
+    uint32_t base { count ? event(first).start : 0 };
+    for (uint32_t i { 1 }; i < count; ++i) {
+        const uint32_t start { event(first + i).start };
+        if (static_cast<int32_t>(start - base) < 0) {
+            base = start;
+        }
+    }
+
+    out.print("{\"traceEvents\":[");
+    for (uint32_t i { 0 }; i < count; ++i) {
+        const Event e { event(first + i) };
+        out.print(i ? ",\n" : "\n");
+        out.print("{\"name\":\"");
+        out.print(e.name);
+        out.print("\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":");
+        printTime(out, e.start - base);
+        out.print(",\"dur\":");
+        printTime(out, e.duration);
+        out.print('}');
+    }
+    out.println("\n]}");
+}
+
+#endif // ADAFRUIT_GFX_PROFILE
@@ -0,0 +1,192 @@
+/*!
+ * @file Adafruit_GFX_Profile.h
+ *
+ * Part of Adafruit's GFX graphics library. Scoped profiling zones recorded
+ * into a ring buffer and exported as Chrome trace events, to see which
+ * widget or primitive costs what.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#pragma once
+
+#include "Arduino.h"
+#include "Print.h"
+
+#ifndef ADAFRUIT_GFX_PROFILE
+#define ADAFRUIT_GFX_PROFILE 0 ///< Set to 1 to record profiling zones, 0 compiles them out
+#endif
+
+// Host programs may draw from several threads, e.g. GFXbandRenderer workers, so the profiler needs to know as well
+#ifndef ADAFRUIT_GFX_HOST_THREADS
+#if defined(__linux__) || defined(__APPLE__) || defined(_WIN32)
+#define ADAFRUIT_GFX_HOST_THREADS 1 ///< Host build with std::thread support
+#else
+#define ADAFRUIT_GFX_HOST_THREADS 0 ///< Microcontroller build, no threads
+#endif
+#endif
+
+
+#if ADAFRUIT_GFX_PROFILE
+
+#if ADAFRUIT_GFX_HOST_THREADS
+#include <atomic>
+#endif
+
+#ifndef ADAFRUIT_GFX_PROFILE_EVENTS
+#define ADAFRUIT_GFX_PROFILE_EVENTS 256 ///< Size of the event ring buffer, must be a power of 2
+#endif
+
+// The clock is a compile-time choice, so a zone costs two reads of it and one store. A cycle counter gives the
+// best resolution on ARM: -DADAFRUIT_GFX_PROFILE_CLOCK=ARM_DWT_CYCCNT -DADAFRUIT_GFX_PROFILE_TICKS_PER_US=(F_CPU/1000000)
+#ifndef ADAFRUIT_GFX_PROFILE_CLOCK
+#if defined(__linux__) || defined(__APPLE__) || defined(_WIN32)
+#include <chrono>
+
+/// Host clock in nanoseconds
+inline uint32_t gfxProfileHostClock() {
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+#define ADAFRUIT_GFX_PROFILE_CLOCK gfxProfileHostClock() ///< Host clock
+#define ADAFRUIT_GFX_PROFILE_TICKS_PER_US 1000 ///< Clock ticks per microsecond
+#else
+#define ADAFRUIT_GFX_PROFILE_CLOCK static_cast<uint32_t>(micros()) ///< Device clock
+#define ADAFRUIT_GFX_PROFILE_TICKS_PER_US 1 ///< Clock ticks per microsecond
+#endif
+#endif
+
+
+/*!
+ * @brief  Global recorder of profiling zones. Every finished zone is stored
+ *         as one event in a ring buffer of ADAFRUIT_GFX_PROFILE_EVENTS
+ *         entries, overwriting the oldest ones. Timestamps are 32-bit clock
+ *         ticks, so an export covers correctly up to 2^32 ticks (71 minutes
+ *         with micros(), 4.2 seconds with the nanosecond host clock).
+ *         With ADAFRUIT_GFX_HOST_THREADS every record claims its slot with an
+ *         atomic increment, so zones may be recorded from several threads;
+ *         export and clear while none are running. Otherwise record from one
+ *         thread (and no interrupts) only.
+ */
+class GFXprofiler {
+public:
+    /// A finished zone
+    struct Event {
+        const char* name; ///< Zone name
+        uint32_t start; ///< Clock ticks at entry
+        uint32_t duration; ///< Clock ticks spent in the zone
+    };
+
+    /*!
+        @brief    Read the profiling clock
+        @returns  Current clock ticks
+    */
+    static uint32_t now() {
+        return ADAFRUIT_GFX_PROFILE_CLOCK;
+    }
+
+    /*!
+        @brief    Store a finished zone
+        @param    name   Zone name, must stay valid until exported
+        @param    start  Clock ticks at entry
+        @param    end    Clock ticks at exit
+    */
+    static void record(const char* name, uint32_t start, uint32_t end) {
+#if ADAFRUIT_GFX_HOST_THREADS
+        // Once the ring wraps, a slot may be rewritten while another thread still fills it; relaxed atomics keep
+        // that defined, an exported event is at worst mixed from two zones
+        Slot& slot { _events[_head.fetch_add(1, std::memory_order_relaxed) & (ADAFRUIT_GFX_PROFILE_EVENTS - 1)] };
+        slot.name.store(name, std::memory_order_relaxed);
+        slot.start.store(start, std::memory_order_relaxed);
+        slot.duration.store(end - start, std::memory_order_relaxed);
+#else
+        _events[_head++ & (ADAFRUIT_GFX_PROFILE_EVENTS - 1)] = { name, start, end - start };
+#endif
+    }
+
+    /*!
+        @brief    Discard all recorded events
+    */
+    static void clear() {
+        _head = 0;
+    }
+
+    /*!
+        @brief    Get the number of events in the buffer
+        @returns  Event count
+    */
+    static uint32_t size() {
+        const uint32_t head { _head };
+        return head < ADAFRUIT_GFX_PROFILE_EVENTS ? head : ADAFRUIT_GFX_PROFILE_EVENTS;
+    }
+
+    /*!
+        @brief    Write the recorded events as Chrome trace-event JSON, to be loaded in chrome://tracing or Perfetto.
+                  Timestamps are relative to the oldest event. The buffer isn't cleared.
+        @param    out  Output, e.g. Serial or a file
+    */
+    static void exportTrace(Print& out);
+
+private:
+    static_assert((ADAFRUIT_GFX_PROFILE_EVENTS & (ADAFRUIT_GFX_PROFILE_EVENTS - 1)) == 0, "ADAFRUIT_GFX_PROFILE_EVENTS must be a power of 2");
+
+#if ADAFRUIT_GFX_HOST_THREADS
+    /// Event storage shared by the recording threads
+    struct Slot {
+        std::atomic<const char*> name;
+        std::atomic<uint32_t> start;
+        std::atomic<uint32_t> duration;
+    };
+
+    static Slot _events[ADAFRUIT_GFX_PROFILE_EVENTS];
+    static std::atomic<uint32_t> _head; ///< Number of events recorded since clear()
+#else
+    using Slot = Event;
+
+    static Event _events[ADAFRUIT_GFX_PROFILE_EVENTS];
+    static uint32_t _head; ///< Number of events recorded since clear()
+#endif
+
+    /// Copy of the i-th recorded event, as the host build stores its fields separately
+    static Event event(uint32_t i) {
+        const Slot& slot { _events[i & (ADAFRUIT_GFX_PROFILE_EVENTS - 1)] };
+        return { slot.name, slot.start, slot.duration };
+    }
+};
+
+
+/*!
+ * @brief  Measures the time from its construction to the end of the scope,
+ *         use GFX_PROFILE_ZONE() instead of creating it directly.
+ */
+class GFXprofileZone {
+public:
+    /*!
+        @brief    Enter a zone
+        @param    name  Zone name, a string literal or __func__
+    */
+    explicit GFXprofileZone(const char* name) : _name { name }, _start { GFXprofiler::now() } {}
+
+    ~GFXprofileZone() {
+        GFXprofiler::record(_name, _start, GFXprofiler::now());
+    }
+
+    GFXprofileZone(const GFXprofileZone&) = delete;
+    GFXprofileZone& operator=(const GFXprofileZone&) = delete;
+
+private:
+    const char* const _name;
+    const uint32_t _start;
+};
+
+#define GFX_PROFILE_CONCAT_(a, b) a##b
+#define GFX_PROFILE_CONCAT(a, b) GFX_PROFILE_CONCAT_(a, b)
+/// Profile the rest of the enclosing scope under the given name
+#define GFX_PROFILE_ZONE(name) const GFXprofileZone GFX_PROFILE_CONCAT(gfx_profile_zone_, __LINE__) { name }
+
+#else
+#define GFX_PROFILE_ZONE(name) static_cast<void>(0) ///< Profiling disabled, no code is generated
+#endif // ADAFRUIT_GFX_PROFILE
+
+/// Profile the rest of the enclosing function under its name
+#define GFX_PROFILE_FUNCTION() GFX_PROFILE_ZONE(__func__)
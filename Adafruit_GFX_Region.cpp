@@ -0,0 +1,373 @@
+/*!
+ * @file Adafruit_GFX_Region.cpp
+ *
+ * Part of Adafruit's GFX graphics library. Sets of rectangles with union,
+ * intersection and subtraction, for damage tracking and clipping.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_GFX_Region.h"
+
+#include <cstring>
+
+
+namespace {
+
+/*!
+ * @brief  Collects the result of a region operation band by band. Touching
+ *         spans of a band are joined, and a band with the same spans as the
+ *         band right above it extends that one instead of adding boxes.
+ */
+class BoxWriter {
+public:
+    BoxWriter(GFXbox* out, uint16_t capacity, bool hull)
+        : _out { out }, _capacity { capacity }, _count {}, _band {}, _prev {}, _prev_count {}, _y1 {}, _y2 {}, _hull { hull }, _full { false } {}
+
+    /// Start a band of rows y1 .. y2 - 1
+    void begin(gfx_coord_t y1, gfx_coord_t y2) {
+        _band = _count;
+        _y1 = y1;
+        _y2 = y2;
+    }
+
+    /// Add a span to the current band, spans must come sorted by x
+    void add(gfx_coord_t x1, gfx_coord_t x2) {
+        if (_count > _band && (_hull || _out[_count - 1].x2 == x1)) {
+            _out[_count - 1].x2 = x2;
+            return;
+        }
+        if (_count >= _capacity) {
+            _full = true;
+            return;
+        }
+        _out[_count++] = { x1, _y1, x2, _y2 };
+    }
+
+    /// Finish the current band
+    void end() {
+        const uint16_t n { static_cast<uint16_t>(_count - _band) };
+        if (!n) {
+            return;
+        }
+        if (n == _prev_count && _out[_prev].y2 == _y1) {
+            bool same { true };
+            for (uint16_t i { 0 }; i < n && same; ++i) {
+                same = _out[_prev + i].x1 == _out[_band + i].x1 && _out[_prev + i].x2 == _out[_band + i].x2;
+            }
+            if (same) {
+                for (uint16_t i { 0 }; i < n; ++i) {
+                    _out[_prev + i].y2 = _y2;
+                }
+                _count = _band;
+                return;
+            }
+        }
+        _prev = _band;
+        _prev_count = n;
+    }
+
+    uint16_t count() const {
+        return _count;
+    }
+
+    bool full() const {
+        return _full;
+    }
+
+private:
+    GFXbox* const _out;
+    const uint16_t _capacity;
+    uint16_t _count;
+    uint16_t _band; ///< Index of the first box of the current band
+    uint16_t _prev; ///< Index of the first box of the previous band
+    uint16_t _prev_count; ///< Number of boxes of the previous band
+    gfx_coord_t _y1, _y2;
+    const bool _hull; ///< Reduce each band to one box
+    bool _full;
+};
+
+/// Index of the first box behind the band starting at box i
+uint16_t bandEnd(const GFXbox* boxes, uint16_t count, uint16_t i) {
+    uint16_t j { i };
+    while (j < count && boxes[j].y1 == boxes[i].y1) {
+        ++j;
+    }
+    return j;
+}
+
+/// Whether a pixel inside a and/or b is part of the result
+bool inside(GFXregionBase::Op op, bool in_a, bool in_b) {
+    switch (op) {
+        case GFXregionBase::Op::Union: return in_a || in_b;
+        case GFXregionBase::Op::Intersect: return in_a && in_b;
+        default: return in_a && !in_b;
+    }
+}
+
+/// Combine the spans of one band of each operand, both sorted by x and disjoint
+void combineSpans(GFXregionBase::Op op, const GFXbox* a, uint16_t na, const GFXbox* b, uint16_t nb, BoxWriter& out) {
+    uint16_t i { 0 }, j { 0 };
+    bool in_a { false }, in_b { false }, in_result { false };
+    int32_t start { 0 };
+    while (i < na || j < nb) {
+        // Advance to the next edge of either operand
+        const int32_t xa { i < na ? (in_a ? a[i].x2 : a[i].x1) : INT32_MAX };
+        const int32_t xb { j < nb ? (in_b ? b[j].x2 : b[j].x1) : INT32_MAX };
+        const int32_t x { std::min(xa, xb) };
+        if (xa == x) {
+            i += in_a;
+            in_a = !in_a;
+        }
+        if (xb == x) {
+            j += in_b;
+            in_b = !in_b;
+        }
+
+        const bool now { inside(op, in_a, in_b) };
+        if (now != in_result) {
+            if (now) {
+                start = x;
+            } else {
+                out.add(static_cast<gfx_coord_t>(start), static_cast<gfx_coord_t>(x));
+            }
+            in_result = now;
+        }
+    }
+}
+
+/// Sweep both operands band by band, returns false if the result doesn't fit
+bool combine(GFXregionBase::Op op, const GFXbox* a, uint16_t na, const GFXbox* b, uint16_t nb, BoxWriter& out) {
+    if (!na && !nb) {
+        return true;
+    }
+
+    uint16_t ia { 0 }, ib { 0 };
+    int32_t y { std::min<int32_t>(na ? a[0].y1 : INT32_MAX, nb ? b[0].y1 : INT32_MAX) };
+    while (ia < na || ib < nb) {
+        const uint16_t ea { bandEnd(a, na, ia) }, eb { bandEnd(b, nb, ib) };
+
+        // The rows up to the next band edge of either operand have constant spans
+        int32_t y2 { INT32_MAX };
+        if (ia < na) {
+            y2 = std::min<int32_t>(y2, y < a[ia].y1 ? a[ia].y1 : a[ia].y2);
+        }
+        if (ib < nb) {
+            y2 = std::min<int32_t>(y2, y < b[ib].y1 ? b[ib].y1 : b[ib].y2);
+        }
+        const bool has_a { ia < na && a[ia].y1 <= y }, has_b { ib < nb && b[ib].y1 <= y };
+
+        out.begin(static_cast<gfx_coord_t>(y), static_cast<gfx_coord_t>(y2));
+        combineSpans(op, a + ia, has_a ? ea - ia : 0, b + ib, has_b ? eb - ib : 0, out);
+        out.end();
+        if (out.full()) {
+            return false;
+        }
+
+        y = y2;
+        if (ia < na && a[ia].y2 <= y) {
+            ia = ea;
+        }
+        if (ib < nb && b[ib].y2 <= y) {
+            ib = eb;
+        }
+    }
+    return true;
+}
+
+/// Bounding box of a set of banded boxes
+GFXbox bounds(const GFXbox* boxes, uint16_t count) {
+    if (!count) {
+        return {};
+    }
+    GFXbox result { boxes[0].x1, boxes[0].y1, boxes[0].x2, boxes[count - 1].y2 };
+    for (uint16_t i { 1 }; i < count; ++i) {
+        result.x1 = std::min(result.x1, boxes[i].x1);
+        result.x2 = std::max(result.x2, boxes[i].x2);
+    }
+    return result;
+}
+
+} // namespace
+
+
+GFXbox GFXregionBase::extents() const {
+    return bounds(_boxes, _count);
+}
+
+bool GFXregionBase::contains(gfx_coord_t x, gfx_coord_t y) const {
+    for (const GFXbox& box : *this) {
+        if (box.y1 > y) {
+            break;
+        }
+        if (y < box.y2 && x >= box.x1 && x < box.x2) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool GFXregionBase::overlaps(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h) const {
+    if ((w <= 0) || (h <= 0)) {
+        return false;
+    }
+    const int32_t x2 { x + w }, y2 { y + h };
+    for (const GFXbox& box : *this) {
+        if (box.y1 >= y2) {
+            break;
+        }
+        if (box.y2 > y && box.x1 < x2 && box.x2 > x) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void GFXregionBase::set(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h) {
+    clear();
+    if ((w > 0) && (h > 0)) {
+        _boxes[0] = { x, y, static_cast<gfx_coord_t>(x + w), static_cast<gfx_coord_t>(y + h) };
+        _count = 1;
+    }
+}
+
+void GFXregionBase::translate(gfx_coord_t dx, gfx_coord_t dy) {
+    for (uint16_t i { 0 }; i < _count; ++i) {
+        GFXbox& box { _boxes[i] };
+        box = { static_cast<gfx_coord_t>(box.x1 + dx), static_cast<gfx_coord_t>(box.y1 + dy), static_cast<gfx_coord_t>(box.x2 + dx),
+            static_cast<gfx_coord_t>(box.y2 + dy) };
+    }
+}
+
+void GFXregionBase::apply(Op op, const GFXbox* boxes, uint16_t count, GFXbox* scratch) {
+    // Exact result first, then with one box per band
+    for (const bool hull : { false, true }) {
+        BoxWriter out { scratch, _capacity, hull };
+        if (combine(op, _boxes, _count, boxes, count, out)) {
+            _overflow |= hull;
+            _count = out.count();
+            std::memcpy(_boxes, scratch, _count * sizeof(GFXbox));
+            return;
+        }
+    }
+
+    // Still too many bands, fall back to a bounding box of the result
+    const GFXbox a { extents() }, b { bounds(boxes, count) };
+    GFXbox box { a };
+    switch (op) {
+        case Op::Union:
+            if (!_count) {
+                box = b;
+            } else if (count) {
+                box = { std::min(a.x1, b.x1), std::min(a.y1, b.y1), std::max(a.x2, b.x2), std::max(a.y2, b.y2) };
+            }
+            break;
+
+        case Op::Intersect: box = { std::max(a.x1, b.x1), std::max(a.y1, b.y1), std::min(a.x2, b.x2), std::min(a.y2, b.y2) }; break;
+
+        case Op::Subtract: break;
+    }
+    _overflow = true;
+    _count = (box.x1 < box.x2 && box.y1 < box.y2) ? 1 : 0;
+    _boxes[0] = box;
+}
+
+void GFXregionBase::assign(const GFXregionBase& other) {
+    if (&other == this) {
+        return;
+    }
+    _overflow = other._overflow;
+    if (other._count > _capacity) {
+        _boxes[0] = other.extents();
+        _count = 1;
+        _overflow = true;
+        return;
+    }
+    _count = other._count;
+    std::memcpy(_boxes, other._boxes, _count * sizeof(GFXbox));
+}
+
+
+void GFXclipView::drawPixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) {
+    if (_clip.contains(x, y)) {
+        _target.drawPixel(x, y, color);
+    }
+}
+
+void GFXclipView::writePixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) {
+    if (_clip.contains(x, y)) {
+        _target.writePixel(x, y, color);
+    }
+}
+
+void GFXclipView::writeFillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) {
+    if ((w <= 0) || (h <= 0)) {
+        // Same pixels as the generic fillRect() for degenerate sizes
+        for (gfx_coord_t i { x }; i < x + w; i++) {
+            writeFastVLine(i, y, h, color);
+        }
+        return;
+    }
+    clipped(x, y, w, h, [this, color](gfx_coord_t cx, gfx_coord_t cy, gfx_coord_t cw, gfx_coord_t ch) { _target.writeFillRect(cx, cy, cw, ch, color); });
+}
+
+void GFXclipView::writeFastVLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t h, uint16_t color) {
+    if (h <= 0) {
+        writeLine(x, y, x, y + h - 1, color);
+        return;
+    }
+    clipped(x, y, 1, h, [this, color](gfx_coord_t cx, gfx_coord_t cy, gfx_coord_t, gfx_coord_t ch) { _target.writeFastVLine(cx, cy, ch, color); });
+}
+
+void GFXclipView::writeFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) {
+    if (w <= 0) {
+        writeLine(x, y, x + w - 1, y, color);
+        return;
+    }
+    clipped(x, y, w, 1, [this, color](gfx_coord_t cx, gfx_coord_t cy, gfx_coord_t cw, gfx_coord_t) { _target.writeFastHLine(cx, cy, cw, color); });
+}
+
+void GFXclipView::writeFastHLineAlpha(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color, uint8_t alpha) {
+    if (w <= 0) {
+        return;
+    }
+    clipped(x, y, w, 1,
+        [this, color, alpha](gfx_coord_t cx, gfx_coord_t cy, gfx_coord_t cw, gfx_coord_t) { _target.writeFastHLineAlpha(cx, cy, cw, color, alpha); });
+}
+
+void GFXclipView::drawFastVLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t h, uint16_t color) {
+    startWrite();
+    writeFastVLine(x, y, h, color);
+    endWrite();
+}
+
+void GFXclipView::drawFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) {
+    startWrite();
+    writeFastHLine(x, y, w, color);
+    endWrite();
+}
+
+void GFXclipView::fillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) {
+    startWrite();
+    writeFillRect(x, y, w, h, color);
+    endWrite();
+}
+
+void GFXclipView::writeRGBSpan(gfx_coord_t x, gfx_coord_t y, const uint16_t colors[], gfx_coord_t w) {
+    if (w <= 0) {
+        return;
+    }
+    clipped(x, y, w, 1, [this, x, colors](gfx_coord_t cx, gfx_coord_t cy, gfx_coord_t cw, gfx_coord_t) { _target.writeRGBSpan(cx, cy, colors + (cx - x), cw); });
+}
+
+void GFXclipView::drawRGBBitmap(gfx_coord_t x, gfx_coord_t y, uint16_t* bitmap, gfx_coord_t w, gfx_coord_t h) {
+    if ((w <= 0) || (h <= 0)) {
+        return;
+    }
+    // Rows of the visible parts, the target handles its own transaction for each
+    clipped(x, y, w, h, [this, x, y, bitmap, w](gfx_coord_t cx, gfx_coord_t cy, gfx_coord_t cw, gfx_coord_t ch) {
+        for (gfx_coord_t row { 0 }; row < ch; ++row) {
+            _target.drawRGBBitmap(cx, cy + row, bitmap + static_cast<size_t>(cy + row - y) * w + (cx - x), cw, 1);
+        }
+    });
+}
@@ -0,0 +1,399 @@
+/*!
+ * @file Adafruit_GFX_Region.h
+ *
+ * Part of Adafruit's GFX graphics library. Sets of rectangles with union,
+ * intersection and subtraction, for damage tracking and clipping.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#pragma once
+
+#include "Adafruit_GFX.h"
+
+#include <algorithm>
+
+
+/// A rectangle given by its edges, x2 and y2 are exclusive
+struct GFXbox {
+    gfx_coord_t x1; ///< Left edge
+    gfx_coord_t y1; ///< Top edge
+    gfx_coord_t x2; ///< Right edge + 1
+    gfx_coord_t y2; ///< Bottom edge + 1
+
+    /*!
+        @brief    Get the width of the rectangle
+        @returns  Width in pixels
+    */
+    gfx_coord_t width() const {
+        return x2 - x1;
+    }
+
+    /*!
+        @brief    Get the height of the rectangle
+        @returns  Height in pixels
+    */
+    gfx_coord_t height() const {
+        return y2 - y1;
+    }
+};
+
+
+/*!
+ * @brief  An area of pixels stored as banded rectangles like X11 and pixman
+ *         regions: the boxes are sorted by rows, then columns, boxes of one
+ *         band have the same top and bottom edges, and boxes don't overlap
+ *         or touch within a band. Vertically adjacent bands with the same
+ *         columns are merged, so every area has exactly one representation.
+ *         Iteration yields the boxes in scanline order.
+ *         Storage is a fixed array (see GFXregion), nothing is allocated.
+ *         If a result needs more boxes than that, every band is reduced to
+ *         the box spanning it and, if that is still too much, the region
+ *         becomes its bounding box. The region then covers more than the
+ *         exact result and overflowed() reports it; for damage tracking
+ *         that only costs redundant pixels.
+ */
+class GFXregionBase {
+public:
+    /// Set operation of two regions
+    enum class Op : uint8_t {
+        Union,
+        Intersect,
+        Subtract,
+    };
+
+    GFXregionBase(const GFXregionBase&) = delete;
+
+    /*!
+        @brief    Query whether the region is empty
+        @returns  True if the region doesn't contain any pixel
+    */
+    bool empty() const {
+        return !_count;
+    }
+
+    /*!
+        @brief    Get the number of boxes
+        @returns  Box count
+    */
+    uint16_t size() const {
+        return _count;
+    }
+
+    /*!
+        @brief    Get the maximum number of boxes
+        @returns  Box capacity
+    */
+    uint16_t capacity() const {
+        return _capacity;
+    }
+
+    /*!
+        @brief    Access a box
+        @param    i  Index of the box, must be less than size()
+        @returns  Reference to the box
+    */
+    const GFXbox& operator[](uint16_t i) const {
+        return _boxes[i];
+    }
+
+    /*!
+        @brief    Get the first box, for range-based for loops
+        @returns  Pointer to the first box
+    */
+    const GFXbox* begin() const {
+        return _boxes;
+    }
+
+    /*!
+        @brief    Get the end of the boxes, for range-based for loops
+        @returns  Pointer behind the last box
+    */
+    const GFXbox* end() const {
+        return _boxes + _count;
+    }
+
+    /*!
+        @brief    Query whether a result didn't fit into the capacity since the last clear() or set()
+        @returns  True if the region may be larger than the exact result
+    */
+    bool overflowed() const {
+        return _overflow;
+    }
+
+    /*!
+        @brief    Get the bounding box
+        @returns  Smallest box containing the region, all zero if it's empty
+    */
+    GFXbox extents() const;
+
+    /*!
+        @brief    Query whether a pixel is part of the region
+        @param    x  x coordinate
+        @param    y  y coordinate
+        @returns  True if the pixel is inside
+    */
+    bool contains(gfx_coord_t x, gfx_coord_t y) const;
+
+    /*!
+        @brief    Query whether a rectangle shares pixels with the region
+        @param    x  Top left corner x coordinate
+        @param    y  Top left corner y coordinate
+        @param    w  Width in pixels
+        @param    h  Height in pixels
+        @returns  True if they overlap
+    */
+    bool overlaps(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h) const;
+
+    /*!
+        @brief    Make the region empty and reset overflowed()
+    */
+    void clear() {
+        _count = 0;
+        _overflow = false;
+    }
+
+    /*!
+        @brief    Replace the region by a rectangle and reset overflowed()
+        @param    x  Top left corner x coordinate
+        @param    y  Top left corner y coordinate
+        @param    w  Width in pixels, the region is empty if not positive
+        @param    h  Height in pixels, the region is empty if not positive
+    */
+    void set(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h);
+
+    /*!
+        @brief    Move the region, it must stay within the coordinate range
+        @param    dx  Offset in x direction
+        @param    dy  Offset in y direction
+    */
+    void translate(gfx_coord_t dx, gfx_coord_t dy);
+
+protected:
+    GFXregionBase(GFXbox* boxes, uint16_t capacity) : _boxes { boxes }, _capacity { capacity }, _count {}, _overflow { false } {}
+
+    /*!
+        @brief    Replace the region by the result of an operation with another set of boxes
+        @param    op       Operation, the region is the left operand
+        @param    boxes    Boxes of the right operand in banded order, may be the region's own storage
+        @param    count    Number of boxes of the right operand
+        @param    scratch  Temporary storage of capacity() boxes
+    */
+    void apply(Op op, const GFXbox* boxes, uint16_t count, GFXbox* scratch);
+
+    /*!
+        @brief    Replace the region by a copy of another one
+        @param    other  Region to copy, reduced to its bounding box if it has more boxes than capacity()
+    */
+    void assign(const GFXregionBase& other);
+
+    GFXbox* const _boxes;
+    const uint16_t _capacity;
+    uint16_t _count;
+    bool _overflow;
+};
+
+
+/*!
+ * @brief  A region with storage for N boxes, N * 8 bytes (N * 16 with
+ *         32-bit coordinates). Operations use a temporary array of the same
+ *         size on the stack.
+ */
+template <uint16_t N>
+class GFXregion : public GFXregionBase {
+    static_assert(N > 0, "GFXregion needs room for at least one box");
+
+public:
+    /*!
+        @brief    Create an empty region
+    */
+    GFXregion() : GFXregionBase(_storage, N) {}
+
+    /*!
+        @brief    Create a region covering a rectangle
+        @param    x  Top left corner x coordinate
+        @param    y  Top left corner y coordinate
+        @param    w  Width in pixels
+        @param    h  Height in pixels
+    */
+    GFXregion(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h) : GFXregionBase(_storage, N) {
+        set(x, y, w, h);
+    }
+
+    GFXregion(const GFXregion& other) : GFXregionBase(_storage, N) {
+        assign(other);
+    }
+
+    GFXregion& operator=(const GFXregion& other) {
+        assign(other);
+        return *this;
+    }
+
+    /*!
+        @brief    Copy a region of any capacity
+        @param    other  Region to copy
+        @returns  Reference to this region
+    */
+    GFXregion& operator=(const GFXregionBase& other) {
+        assign(other);
+        return *this;
+    }
+
+    /*!
+        @brief    Add the pixels of another region
+        @param    other  Region to add
+        @returns  Reference to this region
+    */
+    GFXregion& unite(const GFXregionBase& other) {
+        return combine(Op::Union, other);
+    }
+
+    /*!
+        @brief    Add a rectangle, e.g. the area changed by a drawing operation
+        @param    x  Top left corner x coordinate
+        @param    y  Top left corner y coordinate
+        @param    w  Width in pixels, nothing is added if not positive
+        @param    h  Height in pixels, nothing is added if not positive
+        @returns  Reference to this region
+    */
+    GFXregion& unite(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h) {
+        return combine(Op::Union, x, y, w, h);
+    }
+
+    /*!
+        @brief    Keep only the pixels that are also part of another region
+        @param    other  Region to intersect with
+        @returns  Reference to this region
+    */
+    GFXregion& intersect(const GFXregionBase& other) {
+        return combine(Op::Intersect, other);
+    }
+
+    /*!
+        @brief    Keep only the pixels inside a rectangle
+        @param    x  Top left corner x coordinate
+        @param    y  Top left corner y coordinate
+        @param    w  Width in pixels
+        @param    h  Height in pixels
+        @returns  Reference to this region
+    */
+    GFXregion& intersect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h) {
+        return combine(Op::Intersect, x, y, w, h);
+    }
+
+    /*!
+        @brief    Remove the pixels of another region
+        @param    other  Region to remove
+        @returns  Reference to this region
+    */
+    GFXregion& subtract(const GFXregionBase& other) {
+        return combine(Op::Subtract, other);
+    }
+
+    /*!
+        @brief    Remove a rectangle, e.g. the area of an opaque widget covering the ones below
+        @param    x  Top left corner x coordinate
+        @param    y  Top left corner y coordinate
+        @param    w  Width in pixels
+        @param    h  Height in pixels
+        @returns  Reference to this region
+    */
+    GFXregion& subtract(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h) {
+        return combine(Op::Subtract, x, y, w, h);
+    }
+
+private:
+    GFXregion& combine(Op op, const GFXregionBase& other) {
+        GFXbox scratch[N];
+        apply(op, other.begin(), other.size(), scratch);
+        return *this;
+    }
+
+    GFXregion& combine(Op op, gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h) {
+        const GFXbox box { x, y, static_cast<gfx_coord_t>(x + w), static_cast<gfx_coord_t>(y + h) };
+        GFXbox scratch[N];
+        apply(op, &box, (w > 0 && h > 0) ? 1 : 0, scratch);
+        return *this;
+    }
+
+    GFXbox _storage[N];
+};
+
+
+/*!
+ * @brief  Draws onto another target, clipped to a region given in the
+ *         target's (rotated) coordinates. The view has the target's current
+ *         width and height and its own rotation stays 0. Everything drawn
+ *         through it ends up in a few rectangle, line and pixel calls of the
+ *         target, split at the boxes of the clip region; sizes that aren't
+ *         positive take the generic per-pixel paths.
+ *         The region is referenced, changes apply to subsequent drawing.
+ *         A clip region that overflowed its capacity covers more than the
+ *         exact result (see GFXregionBase), so the view then draws outside
+ *         the intended area as well. Check overflowed() after building the
+ *         region and use a larger capacity or a simpler shape if it's set.
+ */
+class GFXclipView : public Adafruit_GFX {
+public:
+    /*!
+        @brief    Create a clipped view
+        @param    target  Target to draw to
+        @param    clip    Pixels that may be drawn, must stay valid while the view is used
+    */
+    GFXclipView(Adafruit_GFX& target, const GFXregionBase& clip) : Adafruit_GFX(target.width(), target.height()), _target { target }, _clip { clip } {}
+
+    virtual void startWrite() override {
+        _target.startWrite();
+    }
+
+    virtual void endWrite() override {
+        _target.endWrite();
+    }
+
+    virtual void drawPixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) override;
+    virtual void writePixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) override;
+    virtual void writeFillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) override;
+    virtual void writeFastVLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t h, uint16_t color) override;
+    virtual void writeFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) override;
+    virtual void writeFastHLineAlpha(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color, uint8_t alpha) override;
+    virtual void drawFastVLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t h, uint16_t color) override;
+    virtual void drawFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) override;
+    virtual void fillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) override;
+    virtual void writeRGBSpan(gfx_coord_t x, gfx_coord_t y, const uint16_t colors[], gfx_coord_t w) override;
+
+    /// Reading isn't clipped, the target's pixels are returned
+    virtual bool readRGBSpan(gfx_coord_t x, gfx_coord_t y, uint16_t colors[], gfx_coord_t w) override {
+        return _target.readRGBSpan(x, y, colors, w);
+    }
+
+    using Adafruit_GFX::drawRGBBitmap;
+    virtual void drawRGBBitmap(gfx_coord_t x, gfx_coord_t y, uint16_t* bitmap, gfx_coord_t w, gfx_coord_t h) override;
+
+    /*!
+        @brief    Query whether the clip region overflowed, see GFXregionBase::overflowed()
+        @returns  True if drawing may not be clipped exactly to the intended area
+    */
+    bool overflowed() const {
+        return _clip.overflowed();
+    }
+
+private:
+    /// Call f(x, y, w, h) for the parts of a non-empty rectangle inside the clip region, in scanline order
+    template <typename F>
+    void clipped(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, F f) const {
+        const int32_t x2 { x + w }, y2 { y + h };
+        for (const GFXbox& box : _clip) {
+            if (box.y1 >= y2) {
+                break;
+            }
+            const int32_t cx1 { std::max<int32_t>(box.x1, x) }, cx2 { std::min<int32_t>(box.x2, x2) };
+            const int32_t cy1 { std::max<int32_t>(box.y1, y) }, cy2 { std::min<int32_t>(box.y2, y2) };
+            if (cx1 < cx2 && cy1 < cy2) {
+                f(static_cast<gfx_coord_t>(cx1), static_cast<gfx_coord_t>(cy1), static_cast<gfx_coord_t>(cx2 - cx1), static_cast<gfx_coord_t>(cy2 - cy1));
+            }
+        }
+    }
+
+    Adafruit_GFX& _target;
+    const GFXregionBase& _clip;
+};
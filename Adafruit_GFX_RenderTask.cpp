@@ -0,0 +1,149 @@
+/*!
+ * @file Adafruit_GFX_RenderTask.cpp
+ *
+ * Part of Adafruit's GFX graphics library. Resumable versions of long
+ * drawing operations, advanced in small steps from the main loop so a big
+ * fill, bitmap or scene doesn't block it for tens of milliseconds.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_GFX_RenderTask.h"
+
+#include <algorithm>
+
+
+namespace {
+
+/// Number of rows of a given visible width that fit into a pixel budget, at least one
+gfx_coord_t rowsFor(uint32_t budget, int32_t width) {
+    return static_cast<gfx_coord_t>(std::min<uint32_t>(std::max<uint32_t>(budget / std::max<int32_t>(width, 1), 1), GFX_COORD_MAX));
+}
+
+/// Visible width of a span, 0 if it's off-screen
+int32_t visibleWidth(const Adafruit_GFX& gfx, gfx_coord_t x, gfx_coord_t w) {
+    return std::max<int32_t>(std::min<int32_t>(x + w, gfx.width()) - std::max<gfx_coord_t>(x, 0), 0);
+}
+
+} // namespace
+
+
+bool GFXrenderTask::run(Adafruit_GFX& gfx, uint32_t budget_us, uint32_t quantum) {
+    const uint32_t start { static_cast<uint32_t>(micros()) };
+    uint32_t last { start };
+    uint32_t size { quantum };
+    while (!step(gfx, size)) {
+        const uint32_t now { static_cast<uint32_t>(micros()) };
+        const uint32_t used { now - start };
+        if (used >= budget_us) {
+            return false;
+        }
+        // Size the next step to what's left of the budget, based on the speed of the last one
+        if (now != last) {
+            size = static_cast<uint32_t>(std::min<uint64_t>(quantum, static_cast<uint64_t>(budget_us - used) * size / (now - last)));
+            if (!size) {
+                return false;
+            }
+        }
+        last = now;
+    }
+    return true;
+}
+
+
+bool GFXfillTask::step(Adafruit_GFX& gfx, uint32_t budget) {
+    if (_done) {
+        return true;
+    }
+    if ((_w <= 0) || (_h <= 0)) {
+        // Nothing to split, keep the exact behaviour of the blocking call
+        gfx.fillRect(_x, _y, _w, _h, _color);
+        _done = true;
+        return true;
+    }
+
+    const gfx_coord_t end { static_cast<gfx_coord_t>(std::min<int32_t>(_y + _h, gfx.height())) };
+    _row = std::max<gfx_coord_t>(_row, 0);
+    const int32_t width { visibleWidth(gfx, _x, _w) };
+    if (_row < end && width) {
+        const gfx_coord_t rows { static_cast<gfx_coord_t>(std::min<int32_t>(rowsFor(budget, width), end - _row)) };
+        gfx.fillRect(_x, _row, _w, rows, _color);
+        _row += rows;
+    }
+    _done = (_row >= end) || !width;
+    return _done;
+}
+
+
+bool GFXbitmapTask::step(Adafruit_GFX& gfx, uint32_t budget) {
+    if (_done) {
+        return true;
+    }
+
+    const gfx_coord_t end { static_cast<gfx_coord_t>(std::min<int32_t>(_h, gfx.height() - _y)) }; // exclusive, in bitmap rows
+    _row = std::max<gfx_coord_t>(_row, -_y);
+    const int32_t width { visibleWidth(gfx, _x, _w) };
+    if (_row < end && width) {
+        const gfx_coord_t rows { static_cast<gfx_coord_t>(std::min<int32_t>(rowsFor(budget, width), end - _row)) };
+        gfx.drawRGBBitmap(_x, _y + _row, _bitmap + _row * _w, _w, rows);
+        _row += rows;
+    }
+    _done = (_row >= end) || !width;
+    return _done;
+}
+
+
+bool GFXreplayTask::step(Adafruit_GFX& gfx, uint32_t budget) {
+    using Op = GFXdisplayList::Op;
+
+    uint32_t spent { 0 };
+    gfx.startWrite();
+    while (_index < _list.size() && (spent < budget || !spent)) {
+        const GFXdisplayList::Command& cmd { _list[_index] };
+
+        gfx_coord_t x { cmd.x }, y { cmd.y }, w { cmd.w }, h { cmd.h };
+        if (cmd.op == Op::Screen) {
+            // Same pixels as fillScreen() on all targets
+            x = y = 0;
+            w = gfx.width();
+            h = gfx.height();
+        }
+        const int32_t width { visibleWidth(gfx, x, w) };
+
+        if ((cmd.op == Op::Rect || cmd.op == Op::Screen) && w > 0 && h > 0 && width) {
+            if (_row == GFX_COORD_MIN) {
+                _row = std::max<gfx_coord_t>(y, 0);
+            }
+            const gfx_coord_t end { static_cast<gfx_coord_t>(std::min<int32_t>(y + h, gfx.height())) };
+            while (_row < end && (spent < budget || !spent)) {
+                const gfx_coord_t rows { static_cast<gfx_coord_t>(std::min<int32_t>(rowsFor(budget - std::min(spent, budget), width), end - _row)) };
+                gfx.writeFillRect(x, _row, w, rows, cmd.color);
+                _row += rows;
+                spent += rows * width;
+            }
+            if (_row < end) {
+                break;
+            }
+            _row = GFX_COORD_MIN;
+            ++_index;
+            continue;
+        }
+
+        GFXdisplayList::execute(gfx, cmd);
+        switch (cmd.op) {
+            case Op::HLine:
+                /* no break */
+            case Op::AlphaHLine: spent += abs(w); break;
+
+            case Op::VLine: spent += abs(h); break;
+
+            case Op::Line: spent += std::max(abs(w - x), abs(h - y)) + 1; break;
+
+            default: spent += 1; break;
+        }
+        ++_index;
+    }
+    gfx.endWrite();
+
+    return done();
+}
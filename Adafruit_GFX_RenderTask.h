@@ -0,0 +1,163 @@
+/*!
+ * @file Adafruit_GFX_RenderTask.h
+ *
+ * Part of Adafruit's GFX graphics library. Resumable versions of long
+ * drawing operations, advanced in small steps from the main loop so a big
+ * fill, bitmap or scene doesn't block it for tens of milliseconds.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#pragma once
+
+#include "Adafruit_GFX.h"
+#include "Adafruit_GFX_DisplayList.h"
+
+
+/*!
+ * @brief  A drawing operation that runs as a state machine. Every step()
+ *         draws about the given number of pixels and returns, the next call
+ *         continues where the last one stopped. Work is split at row
+ *         boundaries of rectangles and bitmaps, so the pixels written are
+ *         exactly those of the blocking call. Each step is a complete bus
+ *         transaction, other code may use the display between two steps.
+ */
+class GFXrenderTask {
+public:
+    virtual ~GFXrenderTask() = default;
+
+    /*!
+        @brief    Advance the operation. Does at least one unit of work (a row or a command) per call.
+        @param    gfx     Target to draw to, must be the same for all steps
+        @param    budget  Approximate number of pixels to draw
+        @returns  True if the operation is finished
+    */
+    virtual bool step(Adafruit_GFX& gfx, uint32_t budget) = 0;
+
+    /*!
+        @brief    Query whether the operation is finished
+        @returns  True if there is nothing left to draw
+    */
+    virtual bool done() const = 0;
+
+    /*!
+        @brief    Start the operation over
+    */
+    virtual void reset() = 0;
+
+    /*!
+        @brief    Advance the operation for a limited time, e.g. once per main loop iteration.
+                  Steps are sized by the speed of the previous one to end close to the deadline;
+                  a single step may overrun it by one row or one command.
+        @param    gfx        Target to draw to
+        @param    budget_us  Time budget in microseconds
+        @param    quantum    Maximum number of pixels per step
+        @returns  True if the operation is finished
+    */
+    bool run(Adafruit_GFX& gfx, uint32_t budget_us, uint32_t quantum = 2048);
+};
+
+
+/*!
+ * @brief  Resumable fillRect(); for fillScreen() use the target's full size
+ */
+class GFXfillTask : public GFXrenderTask {
+public:
+    /*!
+        @brief    Create the task
+        @param    x      Top left corner x coordinate
+        @param    y      Top left corner y coordinate
+        @param    w      Width in pixels
+        @param    h      Height in pixels
+        @param    color  16-bit 5-6-5 Color to fill with
+    */
+    GFXfillTask(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) : _x { x }, _y { y }, _w { w }, _h { h }, _color { color } {
+        reset();
+    }
+
+    virtual bool step(Adafruit_GFX& gfx, uint32_t budget) override;
+
+    virtual bool done() const override {
+        return _done;
+    }
+
+    virtual void reset() override {
+        _row = _y;
+        _done = false;
+    }
+
+protected:
+    const gfx_coord_t _x, _y, _w, _h;
+    const uint16_t _color;
+    gfx_coord_t _row; ///< Next row to fill
+    bool _done;
+};
+
+
+/*!
+ * @brief  Resumable drawRGBBitmap() for RAM-resident bitmaps
+ */
+class GFXbitmapTask : public GFXrenderTask {
+public:
+    /*!
+        @brief    Create the task
+        @param    x       Top left corner x coordinate
+        @param    y       Top left corner y coordinate
+        @param    bitmap  16-bit 5-6-5 bitmap, must stay valid until the task is done
+        @param    w       Width of bitmap in pixels
+        @param    h       Height of bitmap in pixels
+    */
+    GFXbitmapTask(gfx_coord_t x, gfx_coord_t y, uint16_t* bitmap, gfx_coord_t w, gfx_coord_t h) : _x { x }, _y { y }, _w { w }, _h { h }, _bitmap { bitmap } {
+        reset();
+    }
+
+    virtual bool step(Adafruit_GFX& gfx, uint32_t budget) override;
+
+    virtual bool done() const override {
+        return _done;
+    }
+
+    virtual void reset() override {
+        _row = 0;
+        _done = false;
+    }
+
+protected:
+    const gfx_coord_t _x, _y, _w, _h;
+    uint16_t* const _bitmap;
+    gfx_coord_t _row; ///< Next bitmap row to draw
+    bool _done;
+};
+
+
+/*!
+ * @brief  Resumable GFXdisplayList::replay(). Commands are executed in order;
+ *         filled rectangles and fillScreen() are split into bands of rows, so
+ *         a step can end in the middle of them.
+ */
+class GFXreplayTask : public GFXrenderTask {
+public:
+    /*!
+        @brief    Create the task
+        @param    list  Recorded scene, must stay unchanged until the task is done
+    */
+    explicit GFXreplayTask(const GFXdisplayList& list) : _list { list } {
+        reset();
+    }
+
+    virtual bool step(Adafruit_GFX& gfx, uint32_t budget) override;
+
+    virtual bool done() const override {
+        return _index >= _list.size();
+    }
+
+    virtual void reset() override {
+        _index = 0;
+        _row = GFX_COORD_MIN;
+    }
+
+protected:
+    const GFXdisplayList& _list;
+    uint32_t _index; ///< Next command to execute
+    gfx_coord_t _row; ///< Next row of a partially filled rectangle, GFX_COORD_MIN if none is in progress
+};
@@ -0,0 +1,134 @@
+/*!
+ * @file Adafruit_GFX_SaveUnder.cpp
+ *
+ * Part of Adafruit's GFX graphics library. Save-under buffers for popups,
+ * menus and cursors: the pixels an overlay covers are read back before it
+ * is drawn and written back when it goes away.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_GFX_SaveUnder.h"
+#include "Adafruit_GFX_Profile.h"
+#include <algorithm>
+#include <cstdint>
+
+
+GFXsaveUnder::GFXsaveUnder(size_t pool_pixels, uint8_t max_regions)
+    : _pool_pixels { pool_pixels }, _max_regions { std::min<uint8_t>(max_regions, NONE - 1) } {
+    _pool = new uint16_t[pool_pixels];
+    _regions = new Region[_max_regions] {};
+    if (!_pool || !_regions) {
+        _pool_pixels = 0;
+        _max_regions = 0;
+    }
+}
+
+GFXsaveUnder::~GFXsaveUnder() {
+    delete[] _pool;
+    delete[] _regions;
+}
+
+size_t GFXsaveUnder::allocate(size_t pixels) const {
+    // First fit: move past every region overlapping the candidate until none does
+    size_t offset { 0 };
+    bool moved { true };
+    while (moved) {
+        moved = false;
+        for (uint8_t i { 0 }; i < _max_regions; ++i) {
+            const Region& r { _regions[i] };
+            const size_t end { r.offset + r.pixels };
+            if (r.used && r.offset < offset + pixels && end > offset) {
+                offset = end;
+                moved = true;
+            }
+        }
+    }
+    return offset + pixels <= _pool_pixels ? offset : SIZE_MAX;
+}
+
+uint8_t GFXsaveUnder::save(Adafruit_GFX& gfx, gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h) {
+    GFX_PROFILE_FUNCTION();
+    uint8_t handle { 0 };
+    while (handle < _max_regions && _regions[handle].used) {
+        ++handle;
+    }
+    if (handle == _max_regions) {
+        return NONE;
+    }
+
+    Region& r { _regions[handle] };
+    r.width = std::max<gfx_coord_t>(w, 0);
+    r.height = std::max<gfx_coord_t>(h, 0);
+    r.x = std::max<gfx_coord_t>(x, 0);
+    r.y = std::max<gfx_coord_t>(y, 0);
+    r.w = static_cast<gfx_coord_t>(std::max<int32_t>(std::min<int32_t>(x + r.width, gfx.width()) - r.x, 0));
+    r.h = static_cast<gfx_coord_t>(std::max<int32_t>(std::min<int32_t>(y + r.height, gfx.height()) - r.y, 0));
+    if (!r.w || !r.h) {
+        r.w = r.h = 0;
+    }
+
+    // The whole requested size, not just the visible part, so that move() can reuse the space wherever it goes
+    r.pixels = static_cast<size_t>(r.width) * r.height;
+    const size_t offset { allocate(r.pixels) };
+    if (offset == SIZE_MAX) {
+        return NONE;
+    }
+    r.offset = offset;
+
+    uint16_t* p { _pool + offset };
+    for (gfx_coord_t j { 0 }; j < r.h; ++j, p += r.w) {
+        if (!gfx.readRGBSpan(r.x, r.y + j, p, r.w)) {
+            return NONE;
+        }
+    }
+    r.used = true;
+    return handle;
+}
+
+bool GFXsaveUnder::restore(Adafruit_GFX& gfx, uint8_t handle) {
+    GFX_PROFILE_FUNCTION();
+    if (handle >= _max_regions || !_regions[handle].used) {
+        return false;
+    }
+
+    Region& r { _regions[handle] };
+    if (r.w && r.h) {
+        gfx.drawRGBBitmap(r.x, r.y, _pool + r.offset, r.w, r.h);
+    }
+    r.used = false;
+    return true;
+}
+
+uint8_t GFXsaveUnder::move(Adafruit_GFX& gfx, uint8_t handle, gfx_coord_t x, gfx_coord_t y) {
+    if (!restore(gfx, handle)) {
+        return NONE;
+    }
+    const Region& r { _regions[handle] };
+    return save(gfx, x, y, r.width, r.height);
+}
+
+void GFXsaveUnder::release(uint8_t handle) {
+    if (handle < _max_regions) {
+        _regions[handle].used = false;
+    }
+}
+
+size_t GFXsaveUnder::available() const {
+    // The free gaps lie between the used regions sorted by offset
+    size_t largest { 0 }, offset { 0 };
+    while (offset < _pool_pixels) {
+        size_t next { _pool_pixels }, next_end { _pool_pixels };
+        for (uint8_t i { 0 }; i < _max_regions; ++i) {
+            const Region& r { _regions[i] };
+            const size_t end { r.offset + r.pixels };
+            if (r.used && end > offset && r.offset < next) {
+                next = std::max(r.offset, offset);
+                next_end = end;
+            }
+        }
+        largest = std::max(largest, next - offset);
+        offset = next_end;
+    }
+    return largest;
+}
@@ -0,0 +1,106 @@
+/*!
+ * @file Adafruit_GFX_SaveUnder.h
+ *
+ * Part of Adafruit's GFX graphics library. Save-under buffers for popups,
+ * menus and cursors: the pixels an overlay covers are read back before it
+ * is drawn and written back when it goes away.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#pragma once
+
+#include "Adafruit_GFX.h"
+
+
+/*!
+ * @brief  A pool of save-under buffers. save() copies a rectangle of a
+ *         target into the pool with readRGBSpan(), restore() draws it back
+ *         with one drawRGBBitmap() call and frees the space, so closing a
+ *         popup costs one region copy instead of redrawing what was below.
+ *         Targets that can't read back (readRGBSpan() returns false) make
+ *         save() fail, callers redraw then as before.
+ *         Overlapping overlays must be restored in reverse order of saving.
+ */
+class GFXsaveUnder {
+public:
+    static constexpr uint8_t NONE { 0xff }; ///< Invalid handle, returned if a region couldn't be saved
+
+    /*!
+        @brief    Allocate the pool
+        @param    pool_pixels  Total number of pixels of all regions saved at the same time, 2 bytes each
+        @param    max_regions  Number of regions saved at the same time, at most 254
+    */
+    GFXsaveUnder(size_t pool_pixels, uint8_t max_regions = 4);
+
+    /*!
+        @brief    Free the pool, saved regions are discarded
+    */
+    ~GFXsaveUnder();
+
+    GFXsaveUnder(const GFXsaveUnder&) = delete;
+    GFXsaveUnder& operator=(const GFXsaveUnder&) = delete;
+
+    /*!
+        @brief    Save a rectangle before drawing over it. Parts outside of the target aren't read, but pool space
+                  for the whole w * h pixels is reserved, so move() always finds room for the rectangle.
+        @param    gfx  Target to read from
+        @param    x    Top left corner x coordinate
+        @param    y    Top left corner y coordinate
+        @param    w    Width in pixels
+        @param    h    Height in pixels
+        @returns  Handle for restore(), NONE if the pool is full or the target can't read back pixels
+    */
+    uint8_t save(Adafruit_GFX& gfx, gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h);
+
+    /*!
+        @brief    Write a saved rectangle back and free its buffer
+        @param    gfx     Target to draw to, usually the one it was saved from
+        @param    handle  Handle returned by save()
+        @returns  False if the handle isn't valid
+    */
+    bool restore(Adafruit_GFX& gfx, uint8_t handle);
+
+    /*!
+        @brief    Move a saved rectangle, e.g. for a cursor: restore it and save the same size at the new position.
+                  The pool space is reused, so this fails only if the target can't read back.
+        @param    gfx     Target
+        @param    handle  Handle returned by save()
+        @param    x       New top left corner x coordinate
+        @param    y       New top left corner y coordinate
+        @returns  New handle, NONE if the region couldn't be saved (the old one is restored anyway)
+    */
+    uint8_t move(Adafruit_GFX& gfx, uint8_t handle, gfx_coord_t x, gfx_coord_t y);
+
+    /*!
+        @brief    Free a saved rectangle without drawing it, e.g. if the screen was redrawn anyway
+        @param    handle  Handle returned by save()
+    */
+    void release(uint8_t handle);
+
+    /*!
+        @brief    Get the largest rectangle area that save() can currently store
+        @returns  Number of pixels
+    */
+    size_t available() const;
+
+private:
+    struct Region {
+        size_t offset; ///< First pixel in the pool
+        size_t pixels; ///< Reserved pool space, width * height
+        gfx_coord_t x; ///< Saved rectangle, clipped to the target
+        gfx_coord_t y;
+        gfx_coord_t w;
+        gfx_coord_t h;
+        gfx_coord_t width; ///< Requested size, for move()
+        gfx_coord_t height;
+        bool used;
+    };
+
+    size_t allocate(size_t pixels) const;
+
+    uint16_t* _pool;
+    Region* _regions;
+    size_t _pool_pixels;
+    uint8_t _max_regions;
+};
@@ -0,0 +1,177 @@
+/*!
+ * @file Adafruit_GFX_StaticText.h
+ *
+ * Part of Adafruit's GFX graphics library. Rasterizes constant labels at
+ * compile time into span lists, so drawing them costs no layout or glyph
+ * decoding at runtime.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#pragma once
+
+#include "Adafruit_GFX.h"
+#include "glcdfont.h"
+
+
+/*!
+ * @brief  A text rasterized at compile time: the runs of set pixels that
+ *         print() would draw with the cursor at (0, 0), text size 1 and
+ *         wrapping off, and the bounds of the set pixels. A newline returns
+ *         to the x coordinate passed to draw(). Create it with
+ *         GFX_STATIC_TEXT() as a constexpr variable, so it ends up in flash.
+ * @tparam N  Number of spans
+ */
+template <size_t N>
+struct GFXstaticText {
+    GFXspan spans[N ? N : 1]; ///< Spans relative to the cursor position
+    gfx_coord_t x1; ///< Left edge of the bounds, relative to the cursor
+    gfx_coord_t y1; ///< Top edge of the bounds, relative to the cursor
+    gfx_coord_t w; ///< Width of the bounds
+    gfx_coord_t h; ///< Height of the bounds
+
+    /*!
+        @brief    Draw the text with one drawSpans() call
+        @param    gfx    Target
+        @param    x      Cursor x coordinate, as for setCursor()
+        @param    y      Cursor y coordinate, the baseline for GFXfonts, the top for the classic font
+        @param    color  16-bit 5-6-5 Color to draw with
+        @param    size   Text magnification, as for setTextSize()
+    */
+    void draw(Adafruit_GFX& gfx, gfx_coord_t x, gfx_coord_t y, uint16_t color, uint8_t size = 1) const {
+        gfx.drawSpans(x, y, spans, N, color, size);
+    }
+};
+
+namespace gfx_static_text {
+
+/// Span sink that only counts
+struct Counter {
+    size_t count;
+
+    constexpr void operator()(gfx_coord_t, gfx_coord_t, gfx_coord_t) {
+        ++count;
+    }
+};
+
+/// Span sink that stores the spans and bounds
+template <size_t N>
+struct Writer {
+    GFXstaticText<N>& text;
+    size_t count;
+    gfx_coord_t x2;
+    gfx_coord_t y2;
+
+    constexpr void operator()(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w) {
+        if (!count || x < text.x1) {
+            text.x1 = x;
+        }
+        if (!count || y < text.y1) {
+            text.y1 = y;
+        }
+        if (!count || x + w > x2) {
+            x2 = x + w;
+        }
+        if (!count || y + 1 > y2) {
+            y2 = y + 1;
+        }
+        text.spans[count].x = x;
+        text.spans[count].y = y;
+        text.spans[count].w = w;
+        ++count;
+    }
+};
+
+/// Call sink(x, y, w) for every run of set pixels of a text, laid out like write() without wrapping
+template <typename Sink>
+constexpr void rasterize(const char* text, const GFXfont* gfxFont, Sink& sink) {
+    gfx_coord_t cursor_x { 0 }, cursor_y { 0 };
+    for (; *text; ++text) {
+        uint8_t c { static_cast<uint8_t>(*text) };
+        if (c == '\n') {
+            cursor_x = 0;
+            cursor_y += gfxFont ? gfxFont->yAdvance : 8;
+            continue;
+        }
+        if (c == '\r') {
+            continue;
+        }
+
+        if (!gfxFont) {
+            // Classic font: 5 columns of 8 bits, LSB at the top; rows are taken across the columns
+            if (c >= 176) {
+                ++c; // Same mapping as drawChar() without cp437()
+            }
+            for (uint8_t j { 0 }; j < 8; ++j) {
+                int8_t start { -1 };
+                for (uint8_t i { 0 }; i <= 5; ++i) {
+                    const bool set { (i < 5) && ((font[c * 5 + i] >> j) & 1) };
+                    if (set && start < 0) {
+                        start = static_cast<int8_t>(i);
+                    } else if (!set && start >= 0) {
+                        sink(cursor_x + start, cursor_y + j, i - start);
+                        start = -1;
+                    }
+                }
+            }
+            cursor_x += 6;
+            continue;
+        }
+
+        if (c < gfxFont->first || c > gfxFont->last) {
+            continue;
+        }
+        const GFXglyph& glyph { gfxFont->glyph[c - gfxFont->first] };
+        uint16_t bo { glyph.bitmapOffset };
+        uint8_t bits { 0 }, bit { 0 };
+        for (uint8_t yy { 0 }; yy < glyph.height; ++yy) {
+            int16_t start { -1 };
+            for (uint8_t xx { 0 }; xx <= glyph.width; ++xx) {
+                bool set { false };
+                if (xx < glyph.width) {
+                    if (!(bit++ & 7)) {
+                        bits = gfxFont->bitmap[bo++];
+                    }
+                    set = bits & 0x80;
+                    bits <<= 1;
+                }
+                if (set && start < 0) {
+                    start = xx;
+                } else if (!set && start >= 0) {
+                    sink(cursor_x + glyph.xOffset + start, cursor_y + glyph.yOffset + yy, xx - start);
+                    start = -1;
+                }
+            }
+        }
+        cursor_x += glyph.xAdvance;
+    }
+}
+
+/// Number of spans of a text
+constexpr size_t countSpans(const char* text, const GFXfont* gfxFont) {
+    Counter counter { 0 };
+    rasterize(text, gfxFont, counter);
+    return counter.count;
+}
+
+/// Spans and bounds of a text, N must be countSpans(text, gfxFont)
+template <size_t N>
+constexpr GFXstaticText<N> rasterizeText(const char* text, const GFXfont* gfxFont) {
+    GFXstaticText<N> result {};
+    Writer<N> writer { result, 0, 0, 0 };
+    rasterize(text, gfxFont, writer);
+    result.w = writer.x2 - result.x1;
+    result.h = writer.y2 - result.y1;
+    return result;
+}
+
+} // namespace gfx_static_text
+
+/*!
+    @brief    Rasterize a constant text at compile time, e.g.
+              constexpr auto label = GFX_STATIC_TEXT("Speed", &FreeSans9pt7b); ... label.draw(tft, 10, 30, color);
+              The font must be declared constexpr, as the bundled fonts are.
+    @param    text     String literal
+    @param    gfxFont  Address of a GFXfont, or nullptr for the classic font
+*/
+#define GFX_STATIC_TEXT(text, gfxFont) gfx_static_text::rasterizeText<gfx_static_text::countSpans(text, gfxFont)>(text, gfxFont)
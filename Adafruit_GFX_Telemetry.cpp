@@ -0,0 +1,91 @@
+/*!
+ * @file Adafruit_GFX_Telemetry.cpp
+ *
+ * Part of Adafruit's GFX graphics library. Frame telemetry: render time,
+ * flush time, pixels and bytes of every frame in log-bucketed histograms,
+ * for percentiles in production at a few instructions per frame.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_GFX_Telemetry.h"
+#include <cstring>
+
+
+constexpr uint8_t GFXhistogram::BUCKETS;
+
+void GFXhistogram::clear() {
+    std::memset(_buckets, 0, sizeof(_buckets));
+    _count = 0;
+    _maximum = 0;
+}
+
+uint32_t GFXhistogram::percentile(uint8_t percent) const {
+    if (!_count) {
+        return 0;
+    }
+
+    // Nearest rank: the smallest value with at least percent of all values at or below it
+    const uint32_t rank { static_cast<uint32_t>((static_cast<uint64_t>(_count) * percent + 99) / 100) };
+    uint32_t seen { 0 };
+    for (uint8_t i { 0 }; i < BUCKETS - 1; ++i) {
+        seen += _buckets[i];
+        if (seen >= rank && seen) {
+            const uint32_t upper { lowerBound(i + 1) - 1 };
+            return upper < _maximum ? upper : _maximum;
+        }
+    }
+    return _maximum;
+}
+
+void GFXhistogram::write(Print& out) const {
+    out.print(_count);
+    out.print(' ');
+    out.print(_maximum);
+    for (uint8_t i { 0 }; i < BUCKETS; ++i) {
+        if (_buckets[i]) {
+            out.print(' ');
+            out.print(i);
+            out.print(':');
+            out.print(_buckets[i]);
+        }
+    }
+    out.println();
+}
+
+void GFXtelemetry::clear() {
+    _render.clear();
+    _flush_time.clear();
+    _pixels.clear();
+    _bytes.clear();
+}
+
+void GFXtelemetry::report(Print& out) const {
+    const char* const names[] { "render us", "flush us ", "pixels   ", "bytes    " };
+    const GFXhistogram* const histograms[] { &_render, &_flush_time, &_pixels, &_bytes };
+
+    out.print(_render.count());
+    out.println(" frames      p50\tp95\tp99\tmax");
+    for (uint8_t i { 0 }; i < 4; ++i) {
+        out.print(names[i]);
+        out.print("\t");
+        out.print(histograms[i]->percentile(50));
+        out.print('\t');
+        out.print(histograms[i]->percentile(95));
+        out.print('\t');
+        out.print(histograms[i]->percentile(99));
+        out.print('\t');
+        out.println(histograms[i]->maximum());
+    }
+}
+
+void GFXtelemetry::write(Print& out) const {
+    out.print("render ");
+    _render.write(out);
+    out.print("flush ");
+    _flush_time.write(out);
+    out.print("pixels ");
+    _pixels.write(out);
+    out.print("bytes ");
+    _bytes.write(out);
+}
@@ -0,0 +1,208 @@
+/*!
+ * @file Adafruit_GFX_Telemetry.h
+ *
+ * Part of Adafruit's GFX graphics library. Frame telemetry: render time,
+ * flush time, pixels and bytes of every frame in log-bucketed histograms,
+ * for percentiles in production at a few instructions per frame.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#pragma once
+
+#include "Arduino.h"
+#include "Print.h"
+
+
+/*!
+ * @brief  Histogram of 32-bit values in fixed logarithmic buckets: values
+ *         below 4 get a bucket each, above that every power of 2 is split
+ *         into 4 buckets, so a bucket is at most 25% wide. Adding a value
+ *         costs a count-leading-zeros and an increment; percentiles are
+ *         the upper bound of their bucket, the maximum is exact.
+ */
+class GFXhistogram {
+public:
+    static constexpr uint8_t BUCKETS { 124 }; ///< Number of buckets, covers all 32-bit values
+
+    GFXhistogram() : _buckets {}, _count {}, _maximum {} {}
+
+    /*!
+        @brief    Add a value
+        @param    value  Value to count
+    */
+    void add(uint32_t value) {
+        ++_buckets[bucket(value)];
+        ++_count;
+        if (value > _maximum) {
+            _maximum = value;
+        }
+    }
+
+    /*!
+        @brief    Remove all values
+    */
+    void clear();
+
+    /*!
+        @brief    Get the number of values added
+        @returns  Value count
+    */
+    uint32_t count() const {
+        return _count;
+    }
+
+    /*!
+        @brief    Get the largest value added
+        @returns  Maximum, 0 if empty
+    */
+    uint32_t maximum() const {
+        return _maximum;
+    }
+
+    /*!
+        @brief    Get a percentile
+        @param    percent  Percentile to get, 0 to 100
+        @returns  Upper bound of the bucket holding the percentile, at most the maximum; 0 if empty
+    */
+    uint32_t percentile(uint8_t percent) const;
+
+    /*!
+        @brief    Get the number of values in a bucket
+        @param    index  Bucket index, less than BUCKETS
+        @returns  Count
+    */
+    uint32_t bucketCount(uint8_t index) const {
+        return _buckets[index];
+    }
+
+    /*!
+        @brief    Get the smallest value of a bucket
+        @param    index  Bucket index, less than BUCKETS
+        @returns  Lower bound, the upper bound is the lower bound of the next bucket minus 1
+    */
+    static uint32_t lowerBound(uint8_t index) {
+        if (index < 4) {
+            return index;
+        }
+        const uint8_t shift { static_cast<uint8_t>(index / 4 - 1) };
+        return static_cast<uint32_t>(4 + index % 4) << shift;
+    }
+
+    /*!
+        @brief    Write the histogram as one line of text: count, maximum and the non-empty buckets as
+                  index:count pairs, e.g. "12 1830 30:2 31:9 42:1"
+        @param    out  Output, e.g. Serial
+    */
+    void write(Print& out) const;
+
+private:
+    static uint8_t bucket(uint32_t value) {
+        if (value < 4) {
+            return static_cast<uint8_t>(value);
+        }
+        const uint8_t msb { static_cast<uint8_t>(31 - __builtin_clz(value)) };
+        return static_cast<uint8_t>(4 * (msb - 1) + ((value >> (msb - 2)) & 3));
+    }
+
+    uint32_t _buckets[BUCKETS];
+    uint32_t _count;
+    uint32_t _maximum;
+};
+
+
+/*!
+ * @brief  Records render time, flush time, pixels and bytes of every frame
+ *         into histograms. Call beginFrame() before drawing, beginFlush()
+ *         when the frame is drawn and is sent to the display (right away for
+ *         direct drawing) and endFrame() when it is done. Times are measured
+ *         with micros(). About 2 KB of RAM.
+ */
+class GFXtelemetry {
+public:
+    /*!
+        @brief    Start a frame, i.e. its rendering
+    */
+    void beginFrame() {
+        _start = static_cast<uint32_t>(micros());
+        _flush = _start;
+    }
+
+    /*!
+        @brief    End rendering and start sending the frame to the display
+    */
+    void beginFlush() {
+        _flush = static_cast<uint32_t>(micros());
+    }
+
+    /*!
+        @brief    End a frame and record it
+        @param    pixels  Pixels drawn or sent in the frame
+        @param    bytes   Bytes sent to the display in the frame, e.g. from Adafruit_SPITFT::traffic()
+    */
+    void endFrame(uint32_t pixels = 0, uint32_t bytes = 0) {
+        const uint32_t now { static_cast<uint32_t>(micros()) };
+        _render.add(_flush - _start);
+        _flush_time.add(now - _flush);
+        _pixels.add(pixels);
+        _bytes.add(bytes);
+    }
+
+    /*!
+        @brief    Discard all recorded frames
+    */
+    void clear();
+
+    /*!
+        @brief    Get the render times
+        @returns  Histogram of microseconds from beginFrame() to beginFlush()
+    */
+    const GFXhistogram& renderTime() const {
+        return _render;
+    }
+
+    /*!
+        @brief    Get the flush times
+        @returns  Histogram of microseconds from beginFlush() to endFrame()
+    */
+    const GFXhistogram& flushTime() const {
+        return _flush_time;
+    }
+
+    /*!
+        @brief    Get the pixels per frame
+        @returns  Histogram of the pixels passed to endFrame()
+    */
+    const GFXhistogram& pixels() const {
+        return _pixels;
+    }
+
+    /*!
+        @brief    Get the bytes per frame
+        @returns  Histogram of the bytes passed to endFrame()
+    */
+    const GFXhistogram& bytes() const {
+        return _bytes;
+    }
+
+    /*!
+        @brief    Print p50, p95, p99 and maximum of all histograms
+        @param    out  Output, e.g. Serial
+    */
+    void report(Print& out) const;
+
+    /*!
+        @brief    Write all histograms compactly, one line each prefixed with its name (render, flush,
+                  pixels, bytes), see GFXhistogram::write()
+        @param    out  Output, e.g. Serial
+    */
+    void write(Print& out) const;
+
+private:
+    GFXhistogram _render;
+    GFXhistogram _flush_time;
+    GFXhistogram _pixels;
+    GFXhistogram _bytes;
+    uint32_t _start {};
+    uint32_t _flush {};
+};
@@ -0,0 +1,285 @@
+/*!
+ * @file Adafruit_GFX_TiledCanvas.cpp
+ *
+ * Part of Adafruit's GFX graphics library. A 16-bit canvas stored as tiles
+ * that are allocated on first write, for screens that are mostly background.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#include "Adafruit_GFX_TiledCanvas.h"
+#include "Adafruit_GFX_Profile.h"
+
+#include <algorithm>
+
+
+constexpr uint8_t GFXtiledCanvas16::TILE_SIZE;
+constexpr uint16_t GFXtiledCanvas16::UNIFORM;
+
+GFXtiledCanvas16::GFXtiledCanvas16(gfx_ucoord_t w, gfx_ucoord_t h, uint16_t max_tiles)
+    : Adafruit_GFX(w, h), _max_tiles { max_tiles }, _used {}, _tiles_x { static_cast<gfx_ucoord_t>((w + TILE_SIZE - 1) / TILE_SIZE) },
+      _tiles_y { static_cast<gfx_ucoord_t>((h + TILE_SIZE - 1) / TILE_SIZE) }, _overflow { false } {
+    const size_t tiles { static_cast<size_t>(_tiles_x) * _tiles_y };
+    max_tiles = static_cast<uint16_t>(std::min<size_t>(max_tiles, std::min<size_t>(tiles, UNIFORM)));
+    _tiles = new Tile[tiles];
+    _pool = new uint16_t[static_cast<size_t>(max_tiles) * TILE_SIZE * TILE_SIZE];
+    _free = new uint16_t[max_tiles];
+    _max_tiles = (_tiles && _pool && _free) ? max_tiles : 0;
+    for (uint16_t i { 0 }; i < _max_tiles; ++i) {
+        _free[i] = static_cast<uint16_t>(_max_tiles - 1 - i);
+    }
+    if (_tiles) {
+        for (size_t i { 0 }; i < tiles; ++i) {
+            _tiles[i] = { 0, UNIFORM, true };
+        }
+    }
+}
+
+GFXtiledCanvas16::~GFXtiledCanvas16() {
+    delete[] _tiles;
+    delete[] _pool;
+    delete[] _free;
+}
+
+uint16_t* GFXtiledCanvas16::storage(Tile& tile) {
+    if (tile.slot != UNIFORM) {
+        return _pool + static_cast<size_t>(tile.slot) * TILE_SIZE * TILE_SIZE;
+    }
+    if (_used >= _max_tiles) {
+        _overflow = true;
+        return nullptr;
+    }
+
+    tile.slot = _free[_max_tiles - 1 - _used++];
+    uint16_t* pixels { _pool + static_cast<size_t>(tile.slot) * TILE_SIZE * TILE_SIZE };
+    std::fill_n(pixels, TILE_SIZE * TILE_SIZE, tile.color);
+    return pixels;
+}
+
+void GFXtiledCanvas16::release(Tile& tile) {
+    if (tile.slot != UNIFORM) {
+        _free[_max_tiles - _used--] = tile.slot;
+        tile.slot = UNIFORM;
+    }
+}
+
+bool GFXtiledCanvas16::toRaw(gfx_coord_t& x, gfx_coord_t& y) const {
+    if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) {
+        return false;
+    }
+
+    gfx_coord_t t;
+    switch (rotation) {
+        case 1:
+            t = x;
+            x = WIDTH - 1 - y;
+            y = t;
+            break;
+        case 2:
+            x = WIDTH - 1 - x;
+            y = HEIGHT - 1 - y;
+            break;
+        case 3:
+            t = x;
+            x = y;
+            y = HEIGHT - 1 - t;
+            break;
+    }
+    return true;
+}
+
+void GFXtiledCanvas16::drawPixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) {
+    if (!_tiles || !toRaw(x, y)) {
+        return;
+    }
+
+    Tile& tile { _tiles[static_cast<size_t>(y / TILE_SIZE) * _tiles_x + x / TILE_SIZE] };
+    if (tile.slot == UNIFORM && tile.color == color) {
+        return;
+    }
+    uint16_t* pixels { storage(tile) };
+    if (pixels) {
+        pixels[(y % TILE_SIZE) * TILE_SIZE + x % TILE_SIZE] = color;
+        tile.dirty = true;
+    }
+}
+
+void GFXtiledCanvas16::fillScreen(uint16_t color) {
+    if (!_tiles) {
+        return;
+    }
+
+    for (size_t i { 0 }; i < static_cast<size_t>(_tiles_x) * _tiles_y; ++i) {
+        Tile& tile { _tiles[i] };
+        if (tile.slot != UNIFORM || tile.color != color) {
+            release(tile);
+            tile.color = color;
+            tile.dirty = true;
+        }
+    }
+    _overflow = false;
+}
+
+void GFXtiledCanvas16::fillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) {
+    if ((w <= 0) || (h <= 0)) {
+        // Keep the generic behaviour for degenerate sizes
+        Adafruit_GFX::fillRect(x, y, w, h, color);
+        return;
+    }
+
+    // Clip in logical coordinates, then map the rectangle to the unrotated tile grid
+    const gfx_coord_t x2 { static_cast<gfx_coord_t>(std::min<int32_t>(x + w, _width)) };
+    const gfx_coord_t y2 { static_cast<gfx_coord_t>(std::min<int32_t>(y + h, _height)) };
+    x = std::max<gfx_coord_t>(x, 0);
+    y = std::max<gfx_coord_t>(y, 0);
+    if ((x >= x2) || (y >= y2)) {
+        return;
+    }
+    w = x2 - x;
+    h = y2 - y;
+
+    switch (rotation) {
+        case 0: fillRaw(x, y, w, h, color); break;
+        case 1: fillRaw(WIDTH - y - h, x, h, w, color); break;
+        case 2: fillRaw(WIDTH - x - w, HEIGHT - y - h, w, h, color); break;
+        case 3: fillRaw(y, HEIGHT - x - w, h, w, color); break;
+    }
+}
+
+void GFXtiledCanvas16::drawFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) {
+    if (w <= 0) {
+        Adafruit_GFX::drawFastHLine(x, y, w, color);
+        return;
+    }
+    fillRect(x, y, w, 1, color);
+}
+
+void GFXtiledCanvas16::drawFastVLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t h, uint16_t color) {
+    if (h <= 0) {
+        Adafruit_GFX::drawFastVLine(x, y, h, color);
+        return;
+    }
+    fillRect(x, y, 1, h, color);
+}
+
+void GFXtiledCanvas16::fillRaw(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) {
+    if (!_tiles) {
+        return;
+    }
+
+    for (gfx_coord_t ty { static_cast<gfx_coord_t>(y / TILE_SIZE) }; ty <= (y + h - 1) / TILE_SIZE; ++ty) {
+        const gfx_coord_t top { static_cast<gfx_coord_t>(ty * TILE_SIZE) };
+        const gfx_coord_t tile_h { static_cast<gfx_coord_t>(std::min<int32_t>(TILE_SIZE, HEIGHT - top)) };
+        const gfx_coord_t y0 { std::max(y, top) };
+        const gfx_coord_t y1 { static_cast<gfx_coord_t>(std::min<int32_t>(y + h, top + tile_h)) };
+
+        for (gfx_coord_t tx { static_cast<gfx_coord_t>(x / TILE_SIZE) }; tx <= (x + w - 1) / TILE_SIZE; ++tx) {
+            const gfx_coord_t left { static_cast<gfx_coord_t>(tx * TILE_SIZE) };
+            const gfx_coord_t tile_w { static_cast<gfx_coord_t>(std::min<int32_t>(TILE_SIZE, WIDTH - left)) };
+            const gfx_coord_t x0 { std::max(x, left) };
+            const gfx_coord_t x1 { static_cast<gfx_coord_t>(std::min<int32_t>(x + w, left + tile_w)) };
+
+            Tile& tile { _tiles[static_cast<size_t>(ty) * _tiles_x + tx] };
+            if ((x1 - x0 == tile_w) && (y1 - y0 == tile_h)) {
+                // Whole tile covered, it becomes uniform again
+                if (tile.slot != UNIFORM || tile.color != color) {
+                    release(tile);
+                    tile.color = color;
+                    tile.dirty = true;
+                }
+                continue;
+            }
+            if (tile.slot == UNIFORM && tile.color == color) {
+                continue;
+            }
+
+            uint16_t* pixels { storage(tile) };
+            if (!pixels) {
+                continue;
+            }
+            for (gfx_coord_t row { y0 }; row < y1; ++row) {
+                std::fill_n(pixels + (row - top) * TILE_SIZE + (x0 - left), x1 - x0, color);
+            }
+            tile.dirty = true;
+        }
+    }
+}
+
+void GFXtiledCanvas16::writeFastHLineAlpha(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color, uint8_t alpha) {
+    if (alpha == 255) {
+        writeFastHLine(x, y, w, color);
+        return;
+    }
+    if (!alpha || (y < 0) || (y >= _height)) {
+        return;
+    }
+
+    const gfx_coord_t x2 { static_cast<gfx_coord_t>(std::min<int32_t>(x + w, _width)) };
+    for (x = std::max<gfx_coord_t>(x, 0); x < x2; x++) {
+        drawPixel(x, y, blend565(color, getPixel(x, y), alpha));
+    }
+}
+
+uint16_t GFXtiledCanvas16::getPixel(gfx_coord_t x, gfx_coord_t y) const {
+    if (!_tiles || !toRaw(x, y)) {
+        return 0;
+    }
+
+    const Tile& tile { _tiles[static_cast<size_t>(y / TILE_SIZE) * _tiles_x + x / TILE_SIZE] };
+    if (tile.slot == UNIFORM) {
+        return tile.color;
+    }
+    return _pool[static_cast<size_t>(tile.slot) * TILE_SIZE * TILE_SIZE + (y % TILE_SIZE) * TILE_SIZE + x % TILE_SIZE];
+}
+
+void GFXtiledCanvas16::flush(Adafruit_GFX& gfx, gfx_coord_t x, gfx_coord_t y, bool dirty_only) {
+    GFX_PROFILE_FUNCTION();
+    if (!_tiles) {
+        return;
+    }
+
+    for (gfx_ucoord_t ty { 0 }; ty < _tiles_y; ++ty) {
+        const gfx_coord_t top { static_cast<gfx_coord_t>(ty * TILE_SIZE) };
+        const gfx_coord_t tile_h { static_cast<gfx_coord_t>(std::min<int32_t>(TILE_SIZE, HEIGHT - top)) };
+
+        gfx_ucoord_t tx { 0 };
+        while (tx < _tiles_x) {
+            Tile& tile { _tiles[static_cast<size_t>(ty) * _tiles_x + tx] };
+            if (dirty_only && !tile.dirty) {
+                ++tx;
+                continue;
+            }
+            tile.dirty = false;
+            const gfx_coord_t left { static_cast<gfx_coord_t>(tx * TILE_SIZE) };
+
+            if (tile.slot != UNIFORM) {
+                const gfx_coord_t tile_w { static_cast<gfx_coord_t>(std::min<int32_t>(TILE_SIZE, WIDTH - left)) };
+                uint16_t* pixels { _pool + static_cast<size_t>(tile.slot) * TILE_SIZE * TILE_SIZE };
+                if (tile_w == TILE_SIZE) {
+                    gfx.drawRGBBitmap(x + left, y + top, pixels, TILE_SIZE, tile_h);
+                } else {
+                    // Right edge tile, rows aren't contiguous
+                    for (gfx_coord_t row { 0 }; row < tile_h; ++row) {
+                        gfx.drawRGBBitmap(x + left, y + top + row, pixels + row * TILE_SIZE, tile_w, 1);
+                    }
+                }
+                ++tx;
+                continue;
+            }
+
+            // Merge the following uniform tiles of the same color into one fill
+            gfx_ucoord_t end { static_cast<gfx_ucoord_t>(tx + 1) };
+            while (end < _tiles_x) {
+                Tile& next { _tiles[static_cast<size_t>(ty) * _tiles_x + end] };
+                if (next.slot != UNIFORM || next.color != tile.color || (dirty_only && !next.dirty)) {
+                    break;
+                }
+                next.dirty = false;
+                ++end;
+            }
+            const gfx_coord_t right { static_cast<gfx_coord_t>(std::min<int32_t>(end * TILE_SIZE, WIDTH)) };
+            gfx.fillRect(x + left, y + top, right - left, tile_h, tile.color);
+            tx = end;
+        }
+    }
+}
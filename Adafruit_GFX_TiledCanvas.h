@@ -0,0 +1,128 @@
+/*!
+ * @file Adafruit_GFX_TiledCanvas.h
+ *
+ * Part of Adafruit's GFX graphics library. A 16-bit canvas stored as tiles
+ * that are allocated on first write, for screens that are mostly background.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#pragma once
+
+#include "Adafruit_GFX.h"
+
+
+/*!
+ * @brief  A 16-bit canvas split into TILE_SIZE x TILE_SIZE tiles. A tile
+ *         that was never drawn to is just a color; pixel storage is taken
+ *         from a pool of fixed size when something different is drawn into
+ *         it, and returned when a fill covers the whole tile again. So
+ *         fillScreen() costs one store per tile, and RAM scales with the
+ *         number of detailed tiles instead of the screen size.
+ *         flush() sends uniform tiles as window fills and only transfers the
+ *         pixels of allocated ones, optionally only of tiles changed since
+ *         the last flush.
+ *         If the pool runs out, pixels that would need another tile are lost
+ *         and overflowed() reports it.
+ */
+class GFXtiledCanvas16 : public Adafruit_GFX {
+public:
+    static constexpr uint8_t TILE_SIZE { 16 }; ///< Width and height of a tile in pixels
+
+    /*!
+        @brief    Instatiate a tiled canvas, filled with color 0
+        @param    w          Canvas width, in pixels
+        @param    h          Canvas height, in pixels
+        @param    max_tiles  Number of tiles with pixel storage that can exist at the same time,
+                             TILE_SIZE * TILE_SIZE * 2 bytes each
+    */
+    GFXtiledCanvas16(gfx_ucoord_t w, gfx_ucoord_t h, uint16_t max_tiles);
+
+    /*!
+        @brief    Delete the canvas, free memory
+    */
+    virtual ~GFXtiledCanvas16() override;
+
+    GFXtiledCanvas16(const GFXtiledCanvas16&) = delete;
+    GFXtiledCanvas16& operator=(const GFXtiledCanvas16&) = delete;
+
+    virtual void drawPixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) override;
+    virtual void fillScreen(uint16_t color) override;
+    virtual void fillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) override;
+    virtual void drawFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) override;
+    virtual void drawFastVLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t h, uint16_t color) override;
+    virtual void writeFastHLineAlpha(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color, uint8_t alpha) override;
+
+    /*!
+        @brief    Get the pixel color value at a given coordinate
+        @param    x   x coordinate
+        @param    y   y coordinate
+        @returns  The desired pixel's 16-bit 5-6-5 color value, 0 if outside of the canvas
+    */
+    uint16_t getPixel(gfx_coord_t x, gfx_coord_t y) const;
+
+    /*!
+        @brief    Copy a row of pixels out of the canvas
+        @param    x   Left-most x coordinate
+        @param    y   y coordinate
+        @param    colors  Receives w 16-bit 5-6-5 colors, pixels outside of the canvas read as 0
+        @param    w   Width in pixels
+        @returns  True
+    */
+    virtual bool readRGBSpan(gfx_coord_t x, gfx_coord_t y, uint16_t colors[], gfx_coord_t w) override {
+        for (gfx_coord_t i { 0 }; i < w; i++) {
+            colors[i] = getPixel(x + i, y);
+        }
+        return true;
+    }
+
+    /*!
+        @brief    Draw the canvas to a display (or any other target), unrotated like drawRGBBitmap() of a
+                  GFXcanvas16 buffer. Horizontal runs of uniform tiles of the same color become one
+                  fillRect(), allocated tiles are drawn with drawRGBBitmap().
+        @param    gfx         Target to draw to
+        @param    x           Target x coordinate of the canvas' top left corner
+        @param    y           Target y coordinate of the canvas' top left corner
+        @param    dirty_only  Only draw tiles changed since the last flush
+    */
+    void flush(Adafruit_GFX& gfx, gfx_coord_t x = 0, gfx_coord_t y = 0, bool dirty_only = true);
+
+    /*!
+        @brief    Get the number of tiles currently holding pixel storage
+        @returns  Tile count
+    */
+    uint16_t tilesInUse() const {
+        return _used;
+    }
+
+    /*!
+        @brief    Query whether pixels were lost because the tile pool was exhausted
+        @returns  True if drawing was incomplete since the last fillScreen()
+    */
+    bool overflowed() const {
+        return _overflow;
+    }
+
+private:
+    static constexpr uint16_t UNIFORM { 0xffff }; ///< Tile has no pixel storage
+
+    struct Tile {
+        uint16_t color; ///< Color of a uniform tile
+        uint16_t slot; ///< Pool slot of an allocated tile, UNIFORM if none
+        bool dirty; ///< Changed since the last flush
+    };
+
+    uint16_t* storage(Tile& tile);
+    void release(Tile& tile);
+    void fillRaw(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color);
+    bool toRaw(gfx_coord_t& x, gfx_coord_t& y) const;
+
+    Tile* _tiles;
+    uint16_t* _pool;
+    uint16_t* _free; ///< Stack of free pool slots
+    uint16_t _max_tiles;
+    uint16_t _used;
+    gfx_ucoord_t _tiles_x;
+    gfx_ucoord_t _tiles_y;
+    bool _overflow;
+};
@@ -34,7 +34,9 @@
  */
 
 #include "Adafruit_SPITFT.h"
+#include "Adafruit_GFX_Profile.h"
 #include "Arduino.h"
+#include <cstring>
 
 
 Adafruit_SPITFT::Adafruit_SPITFT(uint16_t w, uint16_t h, int8_t cs, int8_t dc, int8_t rst) : Adafruit_SPITFT(w, h, &SPI, cs, dc, rst) {}
@@ -64,13 +66,65 @@ void Adafruit_SPITFT::initSPI(uint32_t freq) {
     }
 }
 
-void Adafruit_SPITFT::writePixel(int16_t x, int16_t y, uint16_t color) {
+void Adafruit_SPITFT::writePixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) {
     if ((x >= 0) && (x < _width) && (y >= 0) && (y < _height)) {
         setAddrWindow(x, y, 1, 1);
         SPI_WRITE16(color);
     }
 }
 
+void Adafruit_SPITFT::writeRGBSpan(gfx_coord_t x, gfx_coord_t y, const uint16_t colors[], gfx_coord_t w) {
+    if ((y < 0) || (y >= _height)) {
+        return;
+    }
+
+    const gfx_coord_t x2 { static_cast<gfx_coord_t>(std::min<int32_t>(x + w, _width)) };
+    if (x < 0) { // Clip left
+        colors -= x;
+        x = 0;
+    }
+    if (x >= x2) {
+        return;
+    }
+
+    setAddrWindow(x, y, x2 - x, 1);
+    writeBuffered(colors, x2 - x);
+}
+
+bool Adafruit_SPITFT::readRGBSpan(gfx_coord_t x, gfx_coord_t y, uint16_t colors[], gfx_coord_t w) {
+    if (!_read_command) {
+        return false;
+    }
+    for (gfx_coord_t i { 0 }; i < w; i++) {
+        colors[i] = 0;
+    }
+    if ((y < 0) || (y >= _height)) {
+        return true;
+    }
+
+    const gfx_coord_t x2 { static_cast<gfx_coord_t>(std::min<int32_t>(x + w, _width)) };
+    if (x < 0) { // Clip left
+        colors -= x;
+        x = 0;
+    }
+    if (x >= x2) {
+        return true;
+    }
+
+    startWrite();
+    setAddrWindow(x, y, x2 - x, 1);
+    writeCommand(_read_command);
+    spiRead(); // Dummy byte
+    for (gfx_coord_t i { x }; i < x2; i++) {
+        const uint8_t r { spiRead() };
+        const uint8_t g { spiRead() };
+        const uint8_t b { spiRead() };
+        *colors++ = color565(r, g, b);
+    }
+    endWrite();
+    return true;
+}
+
 void Adafruit_SPITFT::writePixels(uint16_t* colors, uint32_t len, bool, bool) const {
     while (len--) {
         SPI_WRITE16(*colors++);
@@ -102,12 +156,13 @@ void Adafruit_SPITFT::writeColor(uint16_t color, uint32_t len) {
                 _spi->transfer(_spi_buffer, nullptr, sizeof(_spi_buffer));
             }
             _spi->transfer(_spi_buffer, nullptr, (len - i * SPI_BLOCKSIZE) * sizeof(uint16_t));
+            countTraffic(len * sizeof(uint16_t), n + 1);
             break;
         }
     }
 }
 
-void Adafruit_SPITFT::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+void Adafruit_SPITFT::writeFillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) {
     if (w && h) { // Nonzero width and height?
         if (w < 0) { // If negative width...
             x += w + 1; //   Move X to left edge
@@ -146,7 +201,7 @@ void Adafruit_SPITFT::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
     }
 }
 
-void Adafruit_SPITFT::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+void Adafruit_SPITFT::writeFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) {
     if ((y >= 0) && (y < _height) && w) { // Y on screen, nonzero width
         if (w < 0) { // If negative width...
             x += w + 1; //   Move X to left edge
@@ -169,7 +224,7 @@ void Adafruit_SPITFT::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t c
     }
 }
 
-void Adafruit_SPITFT::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+void Adafruit_SPITFT::writeFastVLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t h, uint16_t color) {
     if ((x >= 0) && (x < _width) && h) { // X on screen, nonzero height
         if (h < 0) { // If negative height...
             y += h + 1; //   Move Y to top edge
@@ -192,12 +247,12 @@ void Adafruit_SPITFT::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t c
     }
 }
 
-void Adafruit_SPITFT::writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+void Adafruit_SPITFT::writeFillRectPreclipped(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) {
     setAddrWindow(x, y, w, h);
     writeColor(color, (uint32_t) w * h);
 }
 
-void Adafruit_SPITFT::drawPixel(int16_t x, int16_t y, uint16_t color) {
+void Adafruit_SPITFT::drawPixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) {
     // Clip first...
     if ((x >= 0) && (x < _width) && (y >= 0) && (y < _height)) {
         // THEN set up transaction (if needed) and draw...
@@ -208,7 +263,8 @@ void Adafruit_SPITFT::drawPixel(int16_t x, int16_t y, uint16_t color) {
     }
 }
 
-void Adafruit_SPITFT::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+void Adafruit_SPITFT::fillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) {
+    GFX_PROFILE_FUNCTION();
     if (w && h) { // Nonzero width and height?
         if (w < 0) { // If negative width...
             x += w + 1; //   Move X to left edge
@@ -249,7 +305,8 @@ void Adafruit_SPITFT::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint1
     }
 }
 
-void Adafruit_SPITFT::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+void Adafruit_SPITFT::drawFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) {
+    GFX_PROFILE_FUNCTION();
     if ((y >= 0) && (y < _height) && w) { // Y on screen, nonzero width
         if (w < 0) { // If negative width...
             x += w + 1; //   Move X to left edge
@@ -274,7 +331,8 @@ void Adafruit_SPITFT::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t co
     }
 }
 
-void Adafruit_SPITFT::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+void Adafruit_SPITFT::drawFastVLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t h, uint16_t color) {
+    GFX_PROFILE_FUNCTION();
     if ((x >= 0) && (x < _width) && h) { // X on screen, nonzero height
         if (h < 0) { // If negative height...
             y += h + 1; //   Move Y to top edge
@@ -305,8 +363,9 @@ void Adafruit_SPITFT::pushColor(uint16_t color) {
     endWrite();
 }
 
-void Adafruit_SPITFT::drawRGBBitmap(int16_t x, int16_t y, uint16_t* pcolors, int16_t w, int16_t h) {
-    int16_t x2, y2; // Lower-right coord
+void Adafruit_SPITFT::drawRGBBitmap(gfx_coord_t x, gfx_coord_t y, uint16_t* pcolors, gfx_coord_t w, gfx_coord_t h) {
+    GFX_PROFILE_FUNCTION();
+    gfx_coord_t x2, y2; // Lower-right coord
     if ((x >= _width) || // Off-edge right
         (y >= _height) || // " top
         ((x2 = (x + w - 1)) < 0) || // " left
@@ -314,8 +373,8 @@ void Adafruit_SPITFT::drawRGBBitmap(int16_t x, int16_t y, uint16_t* pcolors, int
         return; // " bottom
     }
 
-    int16_t bx1 { 0 }, by1 { 0 }; // Clipped top-left within bitmap
-    const int16_t saveW { w }; // Save original bitmap width value
+    gfx_coord_t bx1 { 0 }, by1 { 0 }; // Clipped top-left within bitmap
+    const gfx_coord_t saveW { w }; // Save original bitmap width value
     if (x < 0) { // Clip left
         w += x;
         bx1 = -x;
@@ -342,3 +401,143 @@ void Adafruit_SPITFT::drawRGBBitmap(int16_t x, int16_t y, uint16_t* pcolors, int
     }
     endWrite();
 }
+
+void Adafruit_SPITFT::flush(GFXcanvas16& canvas, const GFXregionBase& region, gfx_coord_t x, gfx_coord_t y, const GFXcolorTransform* transform) {
+    GFX_PROFILE_FUNCTION();
+    const uint16_t* buffer { canvas.getBuffer() };
+    if (!buffer || region.empty()) {
+        return;
+    }
+    if (transform && transform->identity()) {
+        transform = nullptr;
+    }
+    const bool swap_xy { (canvas.getRotation() & 1) != 0 };
+    const int32_t canvas_w { swap_xy ? canvas.height() : canvas.width() };
+    const int32_t canvas_h { swap_xy ? canvas.width() : canvas.height() };
+
+    startWrite();
+    for (const GFXbox& box : region) {
+        // Clip to the canvas, then to the display
+        const int32_t bx1 { std::max<int32_t>({ box.x1, 0, -x }) };
+        const int32_t by1 { std::max<int32_t>({ box.y1, 0, -y }) };
+        const int32_t bx2 { std::min<int32_t>({ box.x2, canvas_w, _width - x }) };
+        const int32_t by2 { std::min<int32_t>({ box.y2, canvas_h, _height - y }) };
+        if ((bx1 >= bx2) || (by1 >= by2)) {
+            continue;
+        }
+
+        setAddrWindow(x + bx1, y + by1, bx2 - bx1, by2 - by1);
+        if (canvas.isBigEndian() && !transform) {
+            // Already in panel byte order: full-width boxes are one contiguous block, others go row by row
+            if ((bx1 == 0) && (bx2 == canvas_w)) {
+                writeDirect(buffer + static_cast<size_t>(by1) * canvas_w, static_cast<uint32_t>((by2 - by1) * canvas_w));
+            } else {
+                for (int32_t row { by1 }; row < by2; ++row) {
+                    writeDirect(buffer + static_cast<size_t>(row) * canvas_w + bx1, bx2 - bx1);
+                }
+            }
+        } else {
+            for (int32_t row { by1 }; row < by2; ++row) {
+                writeBuffered(buffer + static_cast<size_t>(row) * canvas_w + bx1, bx2 - bx1, transform, canvas.isBigEndian());
+            }
+        }
+    }
+    endWrite();
+}
+
+void Adafruit_SPITFT::flush(GFXcanvas1& canvas, const GFXregionBase& region, uint16_t fg, uint16_t bg, gfx_coord_t x, gfx_coord_t y) {
+    GFX_PROFILE_FUNCTION();
+    const uint8_t* buffer { canvas.getBuffer() };
+    if (!buffer || region.empty()) {
+        return;
+    }
+    const bool swap_xy { (canvas.getRotation() & 1) != 0 };
+    const int32_t canvas_w { swap_xy ? canvas.height() : canvas.width() };
+    const int32_t canvas_h { swap_xy ? canvas.width() : canvas.height() };
+    const size_t stride { static_cast<size_t>(canvas_w + 7) / 8 };
+
+    // 4 byte swapped pixels per nibble, on the stack only while flushing
+    uint16_t lut[16][4];
+    for (uint8_t i { 0 }; i < 16; ++i) {
+        for (uint8_t j { 0 }; j < 4; ++j) {
+            const uint16_t c { (i & (8 >> j)) ? fg : bg };
+            lut[i][j] = static_cast<uint16_t>((c << 8) | (c >> 8));
+        }
+    }
+
+    startWrite();
+    for (const GFXbox& box : region) {
+        // Clip to the canvas, then to the display
+        const int32_t bx1 { std::max<int32_t>({ box.x1, 0, -x }) };
+        const int32_t by1 { std::max<int32_t>({ box.y1, 0, -y }) };
+        const int32_t bx2 { std::min<int32_t>({ box.x2, canvas_w, _width - x }) };
+        const int32_t by2 { std::min<int32_t>({ box.y2, canvas_h, _height - y }) };
+        if ((bx1 >= bx2) || (by1 >= by2)) {
+            continue;
+        }
+
+        setAddrWindow(x + bx1, y + by1, bx2 - bx1, by2 - by1);
+        for (int32_t row { by1 }; row < by2; ++row) {
+            writeMono(lut, buffer + row * stride, bx1, bx2 - bx1);
+        }
+    }
+    endWrite();
+}
+
+void Adafruit_SPITFT::writeDirect(const uint16_t* colors, uint32_t len) {
+    _spi->transfer(colors, nullptr, len * sizeof(uint16_t));
+    countTraffic(len * sizeof(uint16_t));
+}
+
+void Adafruit_SPITFT::writeMono(const uint16_t lut[16][4], const uint8_t* bits, uint32_t x, uint32_t len) {
+    uint32_t count { 0 };
+    while (len) {
+        if (!(x & 3) && (len >= 4)) {
+            // Whole nibble: 4 pixels from the table
+            if (count + 4 > SPI_BLOCKSIZE) {
+                _spi->transfer(_spi_buffer, nullptr, count * sizeof(uint16_t));
+                countTraffic(count * sizeof(uint16_t));
+                count = 0;
+            }
+            const uint8_t nibble { static_cast<uint8_t>((bits[x / 8] >> (4 - (x & 4))) & 0xf) };
+            std::memcpy(&_spi_buffer[count], lut[nibble], sizeof(lut[0]));
+            count += 4;
+            x += 4;
+            len -= 4;
+        } else {
+            // Unaligned start or end of the run: the table's all-set and all-clear entries hold the two colors
+            if (count == SPI_BLOCKSIZE) {
+                _spi->transfer(_spi_buffer, nullptr, count * sizeof(uint16_t));
+                countTraffic(count * sizeof(uint16_t));
+                count = 0;
+            }
+            _spi_buffer[count++] = lut[(bits[x / 8] & (0x80 >> (x & 7))) ? 0xf : 0][0];
+            ++x;
+            --len;
+        }
+    }
+    if (count) {
+        _spi->transfer(_spi_buffer, nullptr, count * sizeof(uint16_t));
+        countTraffic(count * sizeof(uint16_t));
+    }
+}
+
+void Adafruit_SPITFT::writeBuffered(const uint16_t* colors, uint32_t len, const GFXcolorTransform* transform, bool big_endian) {
+    while (len) {
+        const uint32_t count { std::min(SPI_BLOCKSIZE, len) };
+        if (transform) {
+            for (uint32_t i { 0 }; i < count; ++i) {
+                const uint16_t c { transform->apply(big_endian ? GFXcanvas16::swapBytes(colors[i]) : colors[i]) };
+                _spi_buffer[i] = static_cast<uint16_t>((c << 8) | (c >> 8));
+            }
+        } else {
+            for (uint32_t i { 0 }; i < count; ++i) {
+                _spi_buffer[i] = static_cast<uint16_t>((colors[i] << 8) | (colors[i] >> 8));
+            }
+        }
+        _spi->transfer(_spi_buffer, nullptr, count * sizeof(uint16_t));
+        countTraffic(count * sizeof(uint16_t));
+        colors += count;
+        len -= count;
+    }
+}
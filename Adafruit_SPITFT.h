@@ -24,7 +24,12 @@
 #include "Arduino.h"
 #include "SPI.h"
 #include "Adafruit_GFX.h"
+#include "Adafruit_GFX_Region.h"
+#include "Adafruit_GFX_ColorTransform.h"
 
+#ifndef ADAFRUIT_GFX_SPITFT_STATS
+#define ADAFRUIT_GFX_SPITFT_STATS 0 ///< Set to 1 to count the bytes and transactions exchanged with the display, e.g. for benchmarks
+#endif
 
 /*!
  * @brief  Adafruit_SPITFT is an intermediary class between Adafruit_GFX
@@ -101,6 +106,9 @@ public:
      *         for all display types; not an SPI-specific function.
      */
     virtual void startWrite() override {
+#if ADAFRUIT_GFX_SPITFT_STATS
+        ++_traffic.transactions;
+#endif
         _spi->beginTransaction(_spi_settings);
         ::digitalWriteFast(_cs, 0);
     }
@@ -123,7 +131,42 @@ public:
      *   @param  y      Vertical position   (0 = top).
      *   @param  color  16-bit pixel color in '565' RGB format.
      */
-    virtual void writePixel(int16_t x, int16_t y, uint16_t color) override;
+    virtual void writePixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) override;
+
+    /*!
+     *   @brief  Write a row of pixels from memory as one address window, byte
+     *           swapped through the SPI buffer. Not self-contained; should
+     *           follow a startWrite() call. Edge clipping is performed here.
+     *   @param  x       Left-most x coordinate.
+     *   @param  y       Vertical position.
+     *   @param  colors  w 16-bit pixel values in '565' RGB format.
+     *   @param  w       Width in pixels.
+     */
+    virtual void writeRGBSpan(gfx_coord_t x, gfx_coord_t y, const uint16_t colors[], gfx_coord_t w) override;
+
+    /*!
+     *   @brief  Read a row of pixels back from display memory, if enabled by
+     *           setReadCommand(). Handles its own transaction and edge
+     *           clipping, pixels outside of the display read as 0.
+     *   @param  x       Left-most x coordinate.
+     *   @param  y       Vertical position.
+     *   @param  colors  Receives w 16-bit pixel values in '565' RGB format.
+     *   @param  w       Width in pixels.
+     *   @return False if read back is disabled.
+     */
+    virtual bool readRGBSpan(gfx_coord_t x, gfx_coord_t y, uint16_t colors[], gfx_coord_t w) override;
+
+    /*!
+     *   @brief  Enable reading back pixels with readRGBSpan(), for panels
+     *           whose memory read command answers with a dummy byte followed
+     *           by 8-bit red, green and blue per pixel, like the ILI9341 and
+     *           ST7789 (0x2E). Needs MISO connected; many panels only read
+     *           reliably at a lower SPI clock than they write.
+     *   @param  cmd  Memory read command, 0 disables read back (default).
+     */
+    void setReadCommand(uint8_t cmd) {
+        _read_command = cmd;
+    }
 
     /*!
      *   @brief  Issue a series of pixels from memory to the display. Not self-
@@ -165,7 +208,7 @@ public:
      *           optimize for the 'if' case, not the 'else' -- avoids branches
      *           and rejects clipped rectangles at the least-work possibility.
      */
-    virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    virtual void writeFillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) override;
 
     /*!
      *   @brief  Draw a horizontal line on the display. Performs edge clipping
@@ -179,7 +222,7 @@ public:
      *               negative = point of first corner).
      *   @param  color  16-bit line color in '565' RGB format.
      */
-    virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    virtual void writeFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) override;
 
     /*!
      *   @brief  Draw a vertical line on the display. Performs edge clipping and
@@ -193,7 +236,7 @@ public:
      *               negative = above first point).
      *   @param  color  16-bit line color in '565' RGB format.
      */
-    virtual void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+    virtual void writeFastVLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t h, uint16_t color) override;
 
     /*!
      *   @brief  A lower-level version of writeFillRect(). This version requires
@@ -211,7 +254,7 @@ public:
      *   @note   This is a new function, no graphics primitives besides rects
      *           and horizontal/vertical lines are written to best use this yet.
      */
-    void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void writeFillRectPreclipped(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color);
 
     /*
      * These functions are similar to the 'write' functions above, but with
@@ -229,7 +272,7 @@ public:
      *   @param  y      Vertical position   (0 = top).
      *   @param  color  16-bit pixel color in '565' RGB format.
      */
-    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    virtual void drawPixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) override;
 
     /*!
      *   @brief  Draw a filled rectangle to the display. Self-contained and
@@ -250,7 +293,7 @@ public:
      *           performed at all if the rectangle is rejected. It's really not
      *           that much code.
      */
-    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    virtual void fillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) override;
 
     /*!
      *   @brief  Draw a horizontal line on the display. Self-contained and
@@ -267,7 +310,7 @@ public:
      *           writeFastHLine() to handle clipping and so forth) so that the
      *           transaction isn't performed at all if the line is rejected.
      */
-    virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    virtual void drawFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) override;
 
     /*!
      *   @brief  Draw a vertical line on the display. Self-contained and provides
@@ -284,7 +327,7 @@ public:
      *           writeFastVLine() to handle clipping and so forth) so that the
      *           transaction isn't performed at all if the line is rejected.
      */
-    virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+    virtual void drawFastVLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t h, uint16_t color) override;
 
     /*!
      *   @brief  Essentially writePixel() with a transaction around it. I don't
@@ -313,7 +356,39 @@ public:
      *   @param  w        Width of bitmap in pixels.
      *   @param  h        Height of bitmap in pixels.
      */
-    void drawRGBBitmap(int16_t x, int16_t y, uint16_t* pcolors, int16_t w, int16_t h);
+    virtual void drawRGBBitmap(gfx_coord_t x, gfx_coord_t y, uint16_t* pcolors, gfx_coord_t w, gfx_coord_t h) override;
+
+    /*!
+     *   @brief  Draw the parts of a canvas inside a region, e.g. the area changed since the last
+     *           update, instead of the whole buffer. Each box of the region is sent as one address
+     *           window in a single transaction, pixels are byte swapped into the SPI buffer and sent
+     *           in blocks. A big-endian canvas without transform is sent straight from its buffer,
+     *           a box spanning the full canvas width in one transfer. Handles its own transaction and
+     *           edge clipping.
+     *   @param  canvas  Canvas to draw, unrotated like drawRGBBitmap() of its buffer
+     *   @param  region  Pixels to draw, in canvas buffer coordinates
+     *   @param  x       Horizontal position of the canvas' top left corner on the display.
+     *   @param  y       Vertical position of the canvas' top left corner on the display.
+     *   @param  transform  Color transform applied to the pixels sent, the canvas stays unchanged. nullptr for none.
+     */
+    void flush(GFXcanvas16& canvas, const GFXregionBase& region, gfx_coord_t x = 0, gfx_coord_t y = 0, const GFXcolorTransform* transform = nullptr);
+
+    /*!
+     *   @brief  Draw parts of a 1-bit canvas in two colors, so a two-color
+     *           screen needs 1/16 of the RAM of a GFXcanvas16 framebuffer.
+     *           Every box of the region is one address window; canvas rows
+     *           are expanded 4 pixels at a time through a 16-entry table
+     *           straight into the SPI buffer. Call it once per region for
+     *           different color pairs. Handles its own transaction and edge
+     *           clipping.
+     *   @param  canvas  Canvas to draw, unrotated like drawBitmap() of its buffer
+     *   @param  region  Pixels to draw, in canvas buffer coordinates
+     *   @param  fg      Color of set pixels, in '565' RGB format.
+     *   @param  bg      Color of clear pixels, in '565' RGB format.
+     *   @param  x       Horizontal position of the canvas' top left corner on the display.
+     *   @param  y       Vertical position of the canvas' top left corner on the display.
+     */
+    void flush(GFXcanvas1& canvas, const GFXregionBase& region, uint16_t fg, uint16_t bg, gfx_coord_t x = 0, gfx_coord_t y = 0);
 
     /*!
      *   @brief   Given 8-bit red, green and blue values, return a 'packed'
@@ -329,6 +404,31 @@ public:
         return ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | (blue >> 3);
     }
 
+#if ADAFRUIT_GFX_SPITFT_STATS
+    /// Data exchanged with the display, see ADAFRUIT_GFX_SPITFT_STATS
+    struct Traffic {
+        uint32_t bytes; ///< Bytes clocked, commands, data and pixels read back
+        uint32_t commands; ///< Command bytes, each one toggles DC twice
+        uint32_t transfers; ///< Calls to the SPI driver, each one has a setup cost
+        uint32_t transactions; ///< Number of startWrite() calls
+    };
+
+    /*!
+     *   @brief   Get the data exchanged with the display since construction or the last resetTraffic()
+     *   @return  Byte and transaction counts
+     */
+    const Traffic& traffic() const {
+        return _traffic;
+    }
+
+    /*!
+     *   @brief  Clear the byte and transaction counts
+     */
+    void resetTraffic() {
+        _traffic = {};
+    }
+#endif // ADAFRUIT_GFX_SPITFT_STATS
+
 protected:
     /*!
      *   @brief  Configure microcontroller pins for TFT interfacing. Typically
@@ -347,6 +447,9 @@ protected:
      * @param  cmd  8-bit command to write.
      */
     void writeCommand(uint8_t cmd) const {
+#if ADAFRUIT_GFX_SPITFT_STATS
+        ++_traffic.commands;
+#endif
         SPI_DC_LOW();
         spiWrite(cmd);
         SPI_DC_HIGH();
@@ -361,6 +464,7 @@ protected:
      * @return  Unsigned 8-bit value read.
      */
     uint8_t spiRead() const {
+        countTraffic(1);
         return _spi->transfer((uint8_t) 0);
     }
 
@@ -373,6 +477,7 @@ protected:
      * @param  b  8-bit value to write.
      */
     void spiWrite(uint8_t b) const {
+        countTraffic(1);
         _spi->transfer(b);
     }
 
@@ -387,6 +492,7 @@ protected:
      * @param  w  16-bit value to write.
      */
     void SPI_WRITE16(uint16_t w) const {
+        countTraffic(2);
         _spi->transfer16(w);
     }
 
@@ -401,6 +507,7 @@ protected:
      * @param  l  32-bit value to write.
      */
     void SPI_WRITE32(uint32_t l) const {
+        countTraffic(4, 2);
         _spi->transfer16(l >> 16);
         _spi->transfer16(l);
     }
@@ -420,9 +527,53 @@ protected:
     const int8_t _cs; /*!< Chip select pin # (or -1) */
     const int8_t _dc; /*!< Data/command pin # */
 
+#if ADAFRUIT_GFX_SPITFT_STATS
+    mutable Traffic _traffic {}; /*!< Data exchanged with the display */
+#endif
+
 private:
+    /// Add to the byte and transfer counts, compiles to nothing without ADAFRUIT_GFX_SPITFT_STATS
+    void countTraffic(uint32_t bytes, uint32_t transfers = 1) const {
+#if ADAFRUIT_GFX_SPITFT_STATS
+        _traffic.bytes += bytes;
+        _traffic.transfers += transfers;
+#else
+        static_cast<void>(bytes);
+        static_cast<void>(transfers);
+#endif
+    }
+
     static constexpr uint32_t SPI_DEFAULT_FREQ { 24'000'000 };
     static constexpr uint32_t SPI_BLOCKSIZE { 32 };
 
+    /*!
+     *   @brief  Send pixels from memory through the SPI buffer, byte swapped and in blocks.
+     *           Not self-contained; should follow startWrite() and setAddrWindow() calls.
+     *   @param  colors  Pointer to array of 16-bit pixel values in '565' RGB format.
+     *   @param  len     Number of elements in 'colors' array.
+     *   @param  transform  Color transform applied while filling the SPI buffer, nullptr for none.
+     *   @param  big_endian  Colors are stored byte swapped, only valid with a transform (use writeDirect() otherwise).
+     */
+    void writeBuffered(const uint16_t* colors, uint32_t len, const GFXcolorTransform* transform = nullptr, bool big_endian = false);
+
+    /*!
+     *   @brief  Send pixels already in panel byte order straight from memory, in one transfer.
+     *           Not self-contained; should follow startWrite() and setAddrWindow() calls.
+     *   @param  colors  Pointer to array of big-endian 16-bit pixel values in '565' RGB format.
+     *   @param  len     Number of elements in 'colors' array.
+     */
+    void writeDirect(const uint16_t* colors, uint32_t len);
+
+    /*!
+     *   @brief  Send a run of 1-bit pixels expanded through a nibble table.
+     *           Not self-contained; should follow startWrite() and setAddrWindow() calls.
+     *   @param  lut   4 byte swapped pixels per nibble, built by flush().
+     *   @param  bits  Canvas row, most significant bit first.
+     *   @param  x     Index of the first pixel in the row.
+     *   @param  len   Number of pixels.
+     */
+    void writeMono(const uint16_t lut[16][4], const uint8_t* bits, uint32_t x, uint32_t len);
+
     uint16_t _spi_buffer[SPI_BLOCKSIZE];
+    uint8_t _read_command {}; ///< Memory read command, 0 if unsupported
 };
@@ -1,4 +1,4 @@
-const uint8_t FreeMonoBold24pt7bBitmaps[] PROGMEM = {
+constexpr uint8_t FreeMonoBold24pt7bBitmaps[] PROGMEM = {
   0x38, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF3, 0xE7, 0xCF,
   0x9F, 0x3E, 0x7C, 0xF9, 0xF3, 0xE3, 0x82, 0x00, 0x00, 0x00, 0x71, 0xF7,
   0xFF, 0xEF, 0x9E, 0x00, 0xFC, 0x7E, 0xF8, 0x7D, 0xF0, 0xFB, 0xE1, 0xF7,
@@ -567,7 +567,7 @@ const uint8_t FreeMonoBold24pt7bBitmaps[] PROGMEM = {
   0xFF, 0xFC, 0xFF, 0xF3, 0xFF, 0xFF, 0x87, 0xFF, 0x9C, 0x0F, 0xFC, 0x00,
   0x0F, 0xE0, 0x00, 0x1F, 0x00 };
 
-const GFXglyph FreeMonoBold24pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeMonoBold24pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,  28,    0,    1 },   // 0x20 ' '
   {     0,   7,  31,  28,   10,  -29 },   // 0x21 '!'
   {    28,  15,  14,  28,    6,  -28 },   // 0x22 '"'
@@ -664,7 +664,7 @@ const GFXglyph FreeMonoBold24pt7bGlyphs[] PROGMEM = {
   {  6704,  14,  37,  28,    8,  -29 },   // 0x7D '}'
   {  6769,  22,  10,  28,    3,  -17 } }; // 0x7E '~'
 
-const GFXfont FreeMonoBold24pt7b PROGMEM = {
+constexpr GFXfont FreeMonoBold24pt7b PROGMEM = {
   (uint8_t  *)FreeMonoBold24pt7bBitmaps,
   (GFXglyph *)FreeMonoBold24pt7bGlyphs,
   0x20, 0x7E, 47 };
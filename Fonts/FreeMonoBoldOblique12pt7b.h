@@ -1,4 +1,4 @@
-const uint8_t FreeMonoBoldOblique12pt7bBitmaps[] PROGMEM = {
+constexpr uint8_t FreeMonoBoldOblique12pt7bBitmaps[] PROGMEM = {
   0x1C, 0xF3, 0xCE, 0x38, 0xE7, 0x1C, 0x61, 0x86, 0x00, 0x63, 0x8C, 0x00,
   0xE7, 0xE7, 0xE6, 0xC6, 0xC6, 0xC4, 0x84, 0x03, 0x30, 0x19, 0x81, 0xDC,
   0x0C, 0xE0, 0x66, 0x1F, 0xFC, 0xFF, 0xE1, 0x98, 0x0C, 0xC0, 0xEE, 0x06,
@@ -164,7 +164,7 @@ const uint8_t FreeMonoBoldOblique12pt7bBitmaps[] PROGMEM = {
   0x30, 0x18, 0x0C, 0x06, 0x01, 0xC1, 0xE1, 0xC0, 0xC0, 0xE0, 0x70, 0x30,
   0x38, 0x78, 0x38, 0x00, 0x3C, 0x27, 0xE6, 0xEF, 0xCC, 0x38 };
 
-const GFXglyph FreeMonoBoldOblique12pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeMonoBoldOblique12pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,  14,    0,    1 },   // 0x20 ' '
   {     0,   6,  15,  14,    6,  -14 },   // 0x21 '!'
   {    12,   8,   7,  14,    6,  -13 },   // 0x22 '"'
@@ -261,7 +261,7 @@ const GFXglyph FreeMonoBoldOblique12pt7bGlyphs[] PROGMEM = {
   {  1938,   9,  19,  14,    3,  -14 },   // 0x7D '}'
   {  1960,  12,   4,  14,    3,   -7 } }; // 0x7E '~'
 
-const GFXfont FreeMonoBoldOblique12pt7b PROGMEM = {
+constexpr GFXfont FreeMonoBoldOblique12pt7b PROGMEM = {
   (uint8_t  *)FreeMonoBoldOblique12pt7bBitmaps,
   (GFXglyph *)FreeMonoBoldOblique12pt7bGlyphs,
   0x20, 0x7E, 24 };
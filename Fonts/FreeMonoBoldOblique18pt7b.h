@@ -1,4 +1,4 @@
-const uint8_t FreeMonoBoldOblique18pt7bBitmaps[] PROGMEM = {
+constexpr uint8_t FreeMonoBoldOblique18pt7bBitmaps[] PROGMEM = {
   0x0F, 0x07, 0xC7, 0xE3, 0xF1, 0xF0, 0xF8, 0xFC, 0x7C, 0x3E, 0x1F, 0x0F,
   0x07, 0x87, 0xC3, 0xC1, 0xE0, 0x60, 0x00, 0x38, 0x3E, 0x1F, 0x0F, 0x83,
   0x80, 0xF8, 0xFF, 0x0E, 0xF1, 0xEF, 0x1E, 0xE1, 0xCE, 0x1C, 0xC1, 0xCC,
@@ -355,7 +355,7 @@ const uint8_t FreeMonoBoldOblique18pt7bBitmaps[] PROGMEM = {
   0xE0, 0x1E, 0x00, 0x0F, 0x00, 0x1F, 0xC0, 0x1F, 0xF0, 0xFF, 0xFC, 0xFF,
   0x3F, 0xFF, 0x0F, 0xF8, 0x03, 0xF8, 0x00, 0xF0 };
 
-const GFXglyph FreeMonoBoldOblique18pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeMonoBoldOblique18pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,  21,    0,    1 },   // 0x20 ' '
   {     0,   9,  22,  21,    9,  -21 },   // 0x21 '!'
   {    25,  12,  10,  21,    9,  -20 },   // 0x22 '"'
@@ -452,7 +452,7 @@ const GFXglyph FreeMonoBoldOblique18pt7bGlyphs[] PROGMEM = {
   {  4195,  13,  27,  21,    4,  -21 },   // 0x7D '}'
   {  4239,  17,   8,  21,    4,  -13 } }; // 0x7E '~'
 
-const GFXfont FreeMonoBoldOblique18pt7b PROGMEM = {
+constexpr GFXfont FreeMonoBoldOblique18pt7b PROGMEM = {
   (uint8_t  *)FreeMonoBoldOblique18pt7bBitmaps,
   (GFXglyph *)FreeMonoBoldOblique18pt7bGlyphs,
   0x20, 0x7E, 35 };
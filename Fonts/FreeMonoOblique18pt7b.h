@@ -1,4 +1,4 @@
-const uint8_t FreeMonoOblique18pt7bBitmaps[] PROGMEM = {
+constexpr uint8_t FreeMonoOblique18pt7bBitmaps[] PROGMEM = {
   0x00, 0x1C, 0x38, 0x70, 0xC1, 0x83, 0x06, 0x18, 0x30, 0x60, 0xC1, 0x02,
   0x04, 0x00, 0x00, 0x01, 0xC7, 0x8F, 0x1C, 0x00, 0x78, 0x7B, 0xC3, 0xFC,
   0x3D, 0xE1, 0xEF, 0x0F, 0x70, 0x73, 0x83, 0x98, 0x18, 0xC0, 0xC6, 0x06,
@@ -293,7 +293,7 @@ const uint8_t FreeMonoOblique18pt7bBitmaps[] PROGMEM = {
   0x04, 0x03, 0x00, 0x80, 0x20, 0x08, 0x02, 0x01, 0x00, 0xC0, 0xE0, 0x00,
   0x1E, 0x02, 0x66, 0x0D, 0x86, 0x16, 0x06, 0x48, 0x07, 0x00 };
 
-const GFXglyph FreeMonoOblique18pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeMonoOblique18pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,  21,    0,    1 },   // 0x20 ' '
   {     0,   7,  22,  21,    9,  -21 },   // 0x21 '!'
   {    20,  13,  10,  21,    7,  -20 },   // 0x22 '"'
@@ -390,7 +390,7 @@ const GFXglyph FreeMonoOblique18pt7bGlyphs[] PROGMEM = {
   {  3472,  10,  25,  21,    6,  -20 },   // 0x7D '}'
   {  3504,  15,   5,  21,    5,  -11 } }; // 0x7E '~'
 
-const GFXfont FreeMonoOblique18pt7b PROGMEM = {
+constexpr GFXfont FreeMonoOblique18pt7b PROGMEM = {
   (uint8_t  *)FreeMonoOblique18pt7bBitmaps,
   (GFXglyph *)FreeMonoOblique18pt7bGlyphs,
   0x20, 0x7E, 35 };
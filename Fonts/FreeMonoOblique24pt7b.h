@@ -1,4 +1,4 @@
-const uint8_t FreeMonoOblique24pt7bBitmaps[] PROGMEM = {
+constexpr uint8_t FreeMonoOblique24pt7bBitmaps[] PROGMEM = {
   0x01, 0xC0, 0xF0, 0x3C, 0x0E, 0x03, 0x81, 0xE0, 0x78, 0x1C, 0x07, 0x01,
   0xC0, 0xE0, 0x38, 0x0E, 0x03, 0x00, 0xC0, 0x70, 0x1C, 0x06, 0x01, 0x80,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x0F, 0x83, 0xE0, 0xF8,
@@ -538,7 +538,7 @@ const uint8_t FreeMonoOblique24pt7bBitmaps[] PROGMEM = {
   0x00, 0xF8, 0x01, 0xC0, 0x00, 0x0F, 0x00, 0x01, 0xFC, 0x03, 0x70, 0xE0,
   0x7E, 0x07, 0x1E, 0xC0, 0x3F, 0x80, 0x01, 0xE0 };
 
-const GFXglyph FreeMonoOblique24pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeMonoOblique24pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,  28,    0,    1 },   // 0x20 ' '
   {     0,  10,  30,  28,   12,  -28 },   // 0x21 '!'
   {    38,  16,  14,  28,   10,  -28 },   // 0x22 '"'
@@ -635,7 +635,7 @@ const GFXglyph FreeMonoOblique24pt7bGlyphs[] PROGMEM = {
   {  6373,  15,  34,  28,    8,  -27 },   // 0x7D '}'
   {  6437,  20,   6,  28,    7,  -15 } }; // 0x7E '~'
 
-const GFXfont FreeMonoOblique24pt7b PROGMEM = {
+constexpr GFXfont FreeMonoOblique24pt7b PROGMEM = {
   (uint8_t  *)FreeMonoOblique24pt7bBitmaps,
   (GFXglyph *)FreeMonoOblique24pt7bGlyphs,
   0x20, 0x7E, 47 };
@@ -1,4 +1,4 @@
-const uint8_t FreeMonoOblique9pt7bBitmaps[] PROGMEM = {
+constexpr uint8_t FreeMonoOblique9pt7bBitmaps[] PROGMEM = {
   0x11, 0x22, 0x24, 0x40, 0x00, 0xC0, 0xDE, 0xE5, 0x29, 0x00, 0x09, 0x05,
   0x02, 0x82, 0x47, 0xF8, 0xA0, 0x51, 0xFE, 0x28, 0x14, 0x0A, 0x09, 0x00,
   0x08, 0x1D, 0x23, 0x40, 0x70, 0x1C, 0x02, 0x82, 0x84, 0x78, 0x20, 0x20,
@@ -82,7 +82,7 @@ const uint8_t FreeMonoOblique9pt7bBitmaps[] PROGMEM = {
   0x21, 0x04, 0x10, 0x60, 0x24, 0x94, 0x92, 0x52, 0x40, 0x18, 0x20, 0x82,
   0x10, 0x40, 0xC4, 0x10, 0x82, 0x08, 0xC0, 0x61, 0x24, 0x30 };
 
-const GFXglyph FreeMonoOblique9pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeMonoOblique9pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,  11,    0,    1 },   // 0x20 ' '
   {     0,   4,  11,  11,    4,  -10 },   // 0x21 '!'
   {     6,   5,   5,  11,    4,  -10 },   // 0x22 '"'
@@ -179,7 +179,7 @@ const GFXglyph FreeMonoOblique9pt7bGlyphs[] PROGMEM = {
   {   969,   6,  13,  11,    3,  -10 },   // 0x7D '}'
   {   979,   7,   3,  11,    3,   -6 } }; // 0x7E '~'
 
-const GFXfont FreeMonoOblique9pt7b PROGMEM = {
+constexpr GFXfont FreeMonoOblique9pt7b PROGMEM = {
   (uint8_t  *)FreeMonoOblique9pt7bBitmaps,
   (GFXglyph *)FreeMonoOblique9pt7bGlyphs,
   0x20, 0x7E, 18 };
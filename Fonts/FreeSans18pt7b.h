@@ -1,4 +1,4 @@
-const uint8_t FreeSans18pt7bBitmaps[] PROGMEM = {
+constexpr uint8_t FreeSans18pt7bBitmaps[] PROGMEM = {
   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x20, 0x3F, 0xFC, 0xE3, 0xF1,
   0xF8, 0xFC, 0x7E, 0x3F, 0x1F, 0x8E, 0x82, 0x41, 0x00, 0x01, 0xC3, 0x80,
   0x38, 0x70, 0x06, 0x0E, 0x00, 0xC1, 0x80, 0x38, 0x70, 0x07, 0x0E, 0x0F,
@@ -347,7 +347,7 @@ const uint8_t FreeSans18pt7bBitmaps[] PROGMEM = {
   0x38, 0x38, 0xF8, 0xF0, 0xE0, 0x38, 0x00, 0xFC, 0x03, 0xFC, 0x1F, 0x3E,
   0x3C, 0x1F, 0xE0, 0x1F, 0x80, 0x1E, 0x00 };
 
-const GFXglyph FreeSans18pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSans18pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,   9,    0,    1 },   // 0x20 ' '
   {     0,   3,  26,  12,    4,  -25 },   // 0x21 '!'
   {    10,   9,   9,  12,    1,  -24 },   // 0x22 '"'
@@ -444,7 +444,7 @@ const GFXglyph FreeSans18pt7bGlyphs[] PROGMEM = {
   {  4112,   8,  33,  12,    3,  -25 },   // 0x7D '}'
   {  4145,  15,   7,  18,    1,  -15 } }; // 0x7E '~'
 
-const GFXfont FreeSans18pt7b PROGMEM = {
+constexpr GFXfont FreeSans18pt7b PROGMEM = {
   (uint8_t  *)FreeSans18pt7bBitmaps,
   (GFXglyph *)FreeSans18pt7bGlyphs,
   0x20, 0x7E, 42 };
@@ -1,4 +1,4 @@
-const uint8_t FreeSans24pt7bBitmaps[] PROGMEM = {
+constexpr uint8_t FreeSans24pt7bBitmaps[] PROGMEM = {
   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x76, 0x66,
   0x66, 0x00, 0x0F, 0xFF, 0xFF, 0xF1, 0xFE, 0x3F, 0xC7, 0xF8, 0xFF, 0x1F,
   0xE3, 0xFC, 0x7F, 0x8F, 0xF1, 0xEC, 0x19, 0x83, 0x30, 0x60, 0x00, 0x70,
@@ -622,7 +622,7 @@ const uint8_t FreeSans24pt7bBitmaps[] PROGMEM = {
   0x70, 0x1E, 0x1F, 0x83, 0xF0, 0x78, 0x00, 0x3E, 0x00, 0x0F, 0xF0, 0x0D,
   0xFF, 0x01, 0xF0, 0xF8, 0x7C, 0x0F, 0xFD, 0x80, 0x7F, 0x80, 0x03, 0xE0 };
 
-const GFXglyph FreeSans24pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSans24pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,  12,    0,    1 },   // 0x20 ' '
   {     0,   4,  34,  16,    6,  -33 },   // 0x21 '!'
   {    17,  11,  12,  16,    2,  -32 },   // 0x22 '"'
@@ -719,7 +719,7 @@ const GFXglyph FreeSans24pt7bGlyphs[] PROGMEM = {
   {  7386,  11,  44,  16,    2,  -33 },   // 0x7D '}'
   {  7447,  19,   7,  24,    2,  -19 } }; // 0x7E '~'
 
-const GFXfont FreeSans24pt7b PROGMEM = {
+constexpr GFXfont FreeSans24pt7b PROGMEM = {
   (uint8_t  *)FreeSans24pt7bBitmaps,
   (GFXglyph *)FreeSans24pt7bGlyphs,
   0x20, 0x7E, 56 };
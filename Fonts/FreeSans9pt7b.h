@@ -1,4 +1,4 @@
-const uint8_t FreeSans9pt7bBitmaps[] PROGMEM = {
+constexpr uint8_t FreeSans9pt7bBitmaps[] PROGMEM = {
   0xFF, 0xFF, 0xF8, 0xC0, 0xDE, 0xF7, 0x20, 0x09, 0x86, 0x41, 0x91, 0xFF,
   0x13, 0x04, 0xC3, 0x20, 0xC8, 0xFF, 0x89, 0x82, 0x61, 0x90, 0x10, 0x1F,
   0x14, 0xDA, 0x3D, 0x1E, 0x83, 0x40, 0x78, 0x17, 0x08, 0xF4, 0x7A, 0x35,
@@ -96,7 +96,7 @@ const uint8_t FreeSans9pt7bBitmaps[] PROGMEM = {
   0xCE, 0x66, 0x66, 0x66, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xC6, 0x66,
   0x66, 0x67, 0x37, 0x66, 0x66, 0x66, 0xC0, 0x61, 0x24, 0x38 };
 
-const GFXglyph FreeSans9pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSans9pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,   5,    0,    1 },   // 0x20 ' '
   {     0,   2,  13,   6,    2,  -12 },   // 0x21 '!'
   {     4,   5,   4,   6,    1,  -12 },   // 0x22 '"'
@@ -193,7 +193,7 @@ const GFXglyph FreeSans9pt7bGlyphs[] PROGMEM = {
   {  1138,   4,  17,   6,    1,  -12 },   // 0x7D '}'
   {  1147,   7,   3,   9,    1,   -7 } }; // 0x7E '~'
 
-const GFXfont FreeSans9pt7b PROGMEM = {
+constexpr GFXfont FreeSans9pt7b PROGMEM = {
   (uint8_t  *)FreeSans9pt7bBitmaps,
   (GFXglyph *)FreeSans9pt7bGlyphs,
   0x20, 0x7E, 22 };
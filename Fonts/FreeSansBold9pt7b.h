@@ -1,4 +1,4 @@
-const uint8_t FreeSansBold9pt7bBitmaps[] PROGMEM = {
+constexpr uint8_t FreeSansBold9pt7bBitmaps[] PROGMEM = {
   0xFF, 0xFF, 0xFE, 0x48, 0x7E, 0xEF, 0xDF, 0xBF, 0x74, 0x40, 0x19, 0x86,
   0x67, 0xFD, 0xFF, 0x33, 0x0C, 0xC3, 0x33, 0xFE, 0xFF, 0x99, 0x86, 0x61,
   0x90, 0x10, 0x1F, 0x1F, 0xDE, 0xFF, 0x3F, 0x83, 0xC0, 0xFC, 0x1F, 0x09,
@@ -103,7 +103,7 @@ const uint8_t FreeSansBold9pt7bBitmaps[] PROGMEM = {
   0x66, 0x66, 0x67, 0x30, 0xFF, 0xFF, 0x80, 0xCE, 0x66, 0x66, 0x67, 0x76,
   0x66, 0x66, 0x6E, 0xC0, 0x71, 0x8E };
 
-const GFXglyph FreeSansBold9pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSansBold9pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,   5,    0,    1 },   // 0x20 ' '
   {     0,   3,  13,   6,    2,  -12 },   // 0x21 '!'
   {     5,   7,   5,   9,    1,  -12 },   // 0x22 '"'
@@ -200,7 +200,7 @@ const GFXglyph FreeSansBold9pt7bGlyphs[] PROGMEM = {
   {  1219,   4,  17,   7,    2,  -12 },   // 0x7D '}'
   {  1228,   8,   2,   9,    0,   -4 } }; // 0x7E '~'
 
-const GFXfont FreeSansBold9pt7b PROGMEM = {
+constexpr GFXfont FreeSansBold9pt7b PROGMEM = {
   (uint8_t  *)FreeSansBold9pt7bBitmaps,
   (GFXglyph *)FreeSansBold9pt7bGlyphs,
   0x20, 0x7E, 22 };
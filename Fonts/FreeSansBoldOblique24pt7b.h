@@ -1,4 +1,4 @@
-const uint8_t FreeSansBoldOblique24pt7bBitmaps[] PROGMEM = {
+constexpr uint8_t FreeSansBoldOblique24pt7bBitmaps[] PROGMEM = {
   0x01, 0xE0, 0x07, 0xF0, 0x1F, 0xC0, 0xFF, 0x03, 0xF8, 0x0F, 0xE0, 0x3F,
   0x80, 0xFE, 0x07, 0xF0, 0x1F, 0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xE0, 0x1F,
   0x80, 0x7E, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0xF8, 0x03, 0xE0, 0x0F,
@@ -788,7 +788,7 @@ const uint8_t FreeSansBoldOblique24pt7bBitmaps[] PROGMEM = {
   0x03, 0xDF, 0xFE, 0x0F, 0xF0, 0x7F, 0xFB, 0x80, 0xFF, 0xE0, 0x01, 0xFF,
   0x00, 0x03, 0xF0 };
 
-const GFXglyph FreeSansBoldOblique24pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSansBoldOblique24pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,  13,    0,    1 },   // 0x20 ' '
   {     0,  14,  34,  16,    5,  -33 },   // 0x21 '!'
   {    60,  18,  12,  22,    8,  -33 },   // 0x22 '"'
@@ -885,7 +885,7 @@ const GFXglyph FreeSansBoldOblique24pt7bGlyphs[] PROGMEM = {
   {  9328,  18,  43,  18,    2,  -33 },   // 0x7D '}'
   {  9425,  22,   8,  27,    5,  -14 } }; // 0x7E '~'
 
-const GFXfont FreeSansBoldOblique24pt7b PROGMEM = {
+constexpr GFXfont FreeSansBoldOblique24pt7b PROGMEM = {
   (uint8_t  *)FreeSansBoldOblique24pt7bBitmaps,
   (GFXglyph *)FreeSansBoldOblique24pt7bGlyphs,
   0x20, 0x7E, 56 };
@@ -1,4 +1,4 @@
-const uint8_t FreeSansBoldOblique9pt7bBitmaps[] PROGMEM = {
+constexpr uint8_t FreeSansBoldOblique9pt7bBitmaps[] PROGMEM = {
   0x21, 0x8E, 0x73, 0x18, 0xC6, 0x21, 0x19, 0xCE, 0x00, 0xEF, 0xDF, 0xBE,
   0x68, 0x80, 0x06, 0xC1, 0x99, 0xFF, 0xBF, 0xF1, 0xB0, 0x66, 0x0C, 0xC7,
   0xFC, 0xFF, 0x8C, 0x83, 0x30, 0x64, 0x00, 0x02, 0x00, 0xF0, 0x7F, 0x1D,
@@ -122,7 +122,7 @@ const uint8_t FreeSansBoldOblique9pt7bBitmaps[] PROGMEM = {
   0xC4, 0x21, 0x18, 0xC4, 0x23, 0x18, 0x80, 0x1C, 0x3C, 0x38, 0x70, 0xE1,
   0x83, 0x06, 0x1E, 0x5C, 0x60, 0xC1, 0x83, 0x0C, 0x38, 0xE0, 0x71, 0x8E };
 
-const GFXglyph FreeSansBoldOblique9pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSansBoldOblique9pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,   5,    0,    1 },   // 0x20 ' '
   {     0,   5,  13,   6,    2,  -12 },   // 0x21 '!'
   {     9,   7,   5,   9,    3,  -12 },   // 0x22 '"'
@@ -219,7 +219,7 @@ const GFXglyph FreeSansBoldOblique9pt7bGlyphs[] PROGMEM = {
   {  1447,   7,  17,   7,    0,  -13 },   // 0x7D '}'
   {  1462,   8,   2,  11,    2,   -4 } }; // 0x7E '~'
 
-const GFXfont FreeSansBoldOblique9pt7b PROGMEM = {
+constexpr GFXfont FreeSansBoldOblique9pt7b PROGMEM = {
   (uint8_t  *)FreeSansBoldOblique9pt7bBitmaps,
   (GFXglyph *)FreeSansBoldOblique9pt7bGlyphs,
   0x20, 0x7E, 22 };
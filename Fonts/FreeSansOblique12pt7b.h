@@ -1,4 +1,4 @@
-const uint8_t FreeSansOblique12pt7bBitmaps[] PROGMEM = {
+constexpr uint8_t FreeSansOblique12pt7bBitmaps[] PROGMEM = {
   0x0C, 0x61, 0x86, 0x18, 0x63, 0x0C, 0x30, 0xC2, 0x18, 0x61, 0x00, 0x00,
   0xC3, 0x00, 0xCF, 0x3C, 0xE2, 0x8A, 0x20, 0x01, 0x8C, 0x03, 0x18, 0x06,
   0x60, 0x18, 0xC0, 0x31, 0x83, 0xFF, 0x87, 0xFF, 0x03, 0x18, 0x0C, 0x60,
@@ -197,7 +197,7 @@ const uint8_t FreeSansOblique12pt7bBitmaps[] PROGMEM = {
   0x01, 0xC0, 0xE0, 0x60, 0x60, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x03, 0x01,
   0x83, 0x83, 0x80, 0x38, 0x0F, 0x82, 0x38, 0x83, 0xE0, 0x38 };
 
-const GFXglyph FreeSansOblique12pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSansOblique12pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,   7,    0,    1 },   // 0x20 ' '
   {     0,   6,  18,   7,    3,  -17 },   // 0x21 '!'
   {    14,   6,   6,   9,    4,  -16 },   // 0x22 '"'
@@ -294,7 +294,7 @@ const GFXglyph FreeSansOblique12pt7bGlyphs[] PROGMEM = {
   {  2329,   9,  23,   8,   -1,  -16 },   // 0x7D '}'
   {  2355,  11,   5,  14,    3,  -10 } }; // 0x7E '~'
 
-const GFXfont FreeSansOblique12pt7b PROGMEM = {
+constexpr GFXfont FreeSansOblique12pt7b PROGMEM = {
   (uint8_t  *)FreeSansOblique12pt7bBitmaps,
   (GFXglyph *)FreeSansOblique12pt7bGlyphs,
   0x20, 0x7E, 29 };
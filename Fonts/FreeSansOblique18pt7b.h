@@ -1,4 +1,4 @@
-const uint8_t FreeSansOblique18pt7bBitmaps[] PROGMEM = {
+constexpr uint8_t FreeSansOblique18pt7bBitmaps[] PROGMEM = {
   0x03, 0x83, 0x81, 0xC0, 0xE0, 0x70, 0x78, 0x38, 0x1C, 0x0E, 0x07, 0x07,
   0x83, 0x81, 0xC0, 0xE0, 0x60, 0x30, 0x30, 0x18, 0x0C, 0x04, 0x00, 0x00,
   0x01, 0xC0, 0xE0, 0x70, 0x78, 0x00, 0x71, 0xDC, 0x7F, 0x3F, 0x8E, 0xE3,
@@ -413,7 +413,7 @@ const uint8_t FreeSansOblique18pt7bBitmaps[] PROGMEM = {
   0xF8, 0x0F, 0x80, 0xE0, 0x00, 0x1C, 0x00, 0x3F, 0x00, 0x7F, 0x83, 0x63,
   0xC7, 0xC1, 0xFE, 0x00, 0xFC, 0x00, 0x78 };
 
-const GFXglyph FreeSansOblique18pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSansOblique18pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,  10,    0,    1 },   // 0x20 ' '
   {     0,   9,  26,  10,    4,  -25 },   // 0x21 '!'
   {    30,  10,   9,  12,    6,  -24 },   // 0x22 '"'
@@ -510,7 +510,7 @@ const GFXglyph FreeSansOblique18pt7bGlyphs[] PROGMEM = {
   {  4887,  12,  33,  12,    0,  -24 },   // 0x7D '}'
   {  4937,  16,   7,  20,    5,  -15 } }; // 0x7E '~'
 
-const GFXfont FreeSansOblique18pt7b PROGMEM = {
+constexpr GFXfont FreeSansOblique18pt7b PROGMEM = {
   (uint8_t  *)FreeSansOblique18pt7bBitmaps,
   (GFXglyph *)FreeSansOblique18pt7bGlyphs,
   0x20, 0x7E, 42 };
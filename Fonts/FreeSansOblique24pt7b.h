@@ -1,4 +1,4 @@
-const uint8_t FreeSansOblique24pt7bBitmaps[] PROGMEM = {
+constexpr uint8_t FreeSansOblique24pt7bBitmaps[] PROGMEM = {
   0x01, 0xE0, 0x3C, 0x0F, 0x81, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x3C, 0x07,
   0x80, 0xF0, 0x1E, 0x03, 0xC0, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x03,
   0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x38, 0x07, 0x00, 0xE0, 0x18, 0x03, 0x00,
@@ -735,7 +735,7 @@ const uint8_t FreeSansOblique24pt7bBitmaps[] PROGMEM = {
   0x00, 0xCF, 0xFC, 0x0E, 0xE3, 0xF0, 0xE6, 0x07, 0xFF, 0x60, 0x0F, 0xF0,
   0x00, 0x1E, 0x00 };
 
-const GFXglyph FreeSansOblique24pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSansOblique24pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,  13,    0,    1 },   // 0x20 ' '
   {     0,  11,  34,  13,    6,  -33 },   // 0x21 '!'
   {    47,  13,  12,  17,    8,  -32 },   // 0x22 '"'
@@ -832,7 +832,7 @@ const GFXglyph FreeSansOblique24pt7bGlyphs[] PROGMEM = {
   {  8704,  16,  44,  16,   -1,  -33 },   // 0x7D '}'
   {  8792,  21,   7,  27,    6,  -19 } }; // 0x7E '~'
 
-const GFXfont FreeSansOblique24pt7b PROGMEM = {
+constexpr GFXfont FreeSansOblique24pt7b PROGMEM = {
   (uint8_t  *)FreeSansOblique24pt7bBitmaps,
   (GFXglyph *)FreeSansOblique24pt7bGlyphs,
   0x20, 0x7E, 56 };
@@ -1,4 +1,4 @@
-const uint8_t FreeSerif12pt7bBitmaps[] PROGMEM = {
+constexpr uint8_t FreeSerif12pt7bBitmaps[] PROGMEM = {
   0xFF, 0xFE, 0xA8, 0x3F, 0xCF, 0x3C, 0xF3, 0x8A, 0x20, 0x0C, 0x40, 0xC4,
   0x08, 0x40, 0x8C, 0x08, 0xC7, 0xFF, 0x18, 0x81, 0x88, 0x10, 0x81, 0x08,
   0xFF, 0xE1, 0x18, 0x31, 0x03, 0x10, 0x31, 0x02, 0x10, 0x04, 0x07, 0xC6,
@@ -154,7 +154,7 @@ const uint8_t FreeSerif12pt7bBitmaps[] PROGMEM = {
   0x8C, 0x63, 0x06, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xCC, 0x00, 0x38, 0x06,
   0x62, 0x41, 0xC0 };
 
-const GFXglyph FreeSerif12pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSerif12pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,   6,    0,    1 },   // 0x20 ' '
   {     0,   2,  16,   8,    3,  -15 },   // 0x21 '!'
   {     4,   6,   6,  10,    1,  -15 },   // 0x22 '"'
@@ -251,7 +251,7 @@ const GFXglyph FreeSerif12pt7bGlyphs[] PROGMEM = {
   {  1820,   5,  21,  12,    5,  -15 },   // 0x7D '}'
   {  1834,  12,   3,  12,    0,   -6 } }; // 0x7E '~'
 
-const GFXfont FreeSerif12pt7b PROGMEM = {
+constexpr GFXfont FreeSerif12pt7b PROGMEM = {
   (uint8_t  *)FreeSerif12pt7bBitmaps,
   (GFXglyph *)FreeSerif12pt7bGlyphs,
   0x20, 0x7E, 29 };
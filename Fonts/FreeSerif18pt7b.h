@@ -1,4 +1,4 @@
-const uint8_t FreeSerif18pt7bBitmaps[] PROGMEM = {
+constexpr uint8_t FreeSerif18pt7bBitmaps[] PROGMEM = {
   0x6F, 0xFF, 0xFF, 0xFE, 0x66, 0x66, 0x66, 0x64, 0x40, 0x00, 0x6F, 0xF6,
   0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0x46, 0x42, 0x42, 0x42, 0x03, 0x06, 0x01,
   0x83, 0x00, 0xC1, 0x80, 0x61, 0xC0, 0x30, 0xC0, 0x38, 0x60, 0x18, 0x30,
@@ -324,7 +324,7 @@ const uint8_t FreeSerif18pt7bBitmaps[] PROGMEM = {
   0x08, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38,
   0x70, 0xE0, 0x3E, 0x00, 0x7F, 0x87, 0xE3, 0xFE, 0x00, 0x7C };
 
-const GFXglyph FreeSerif18pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSerif18pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,   9,    0,    1 },   // 0x20 ' '
   {     0,   4,  24,  12,    5,  -23 },   // 0x21 '!'
   {    12,   8,   9,  14,    3,  -23 },   // 0x22 '"'
@@ -421,7 +421,7 @@ const GFXglyph FreeSerif18pt7bGlyphs[] PROGMEM = {
   {  3848,   8,  30,  17,    6,  -22 },   // 0x7D '}'
   {  3878,  16,   4,  17,    1,  -10 } }; // 0x7E '~'
 
-const GFXfont FreeSerif18pt7b PROGMEM = {
+constexpr GFXfont FreeSerif18pt7b PROGMEM = {
   (uint8_t  *)FreeSerif18pt7bBitmaps,
   (GFXglyph *)FreeSerif18pt7bGlyphs,
   0x20, 0x7E, 42 };
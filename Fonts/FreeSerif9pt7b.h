@@ -1,4 +1,4 @@
-const uint8_t FreeSerif9pt7bBitmaps[] PROGMEM = {
+constexpr uint8_t FreeSerif9pt7bBitmaps[] PROGMEM = {
   0xFF, 0xEA, 0x03, 0xDE, 0xF7, 0x20, 0x11, 0x09, 0x04, 0x82, 0x4F, 0xF9,
   0x10, 0x89, 0xFF, 0x24, 0x12, 0x09, 0x0C, 0x80, 0x10, 0x7C, 0xD6, 0xD2,
   0xD0, 0xF0, 0x38, 0x1E, 0x17, 0x93, 0x93, 0xD6, 0x7C, 0x10, 0x38, 0x43,
@@ -90,7 +90,7 @@ const uint8_t FreeSerif9pt7bBitmaps[] PROGMEM = {
   0x63, 0x18, 0xC4, 0x61, 0x8C, 0x63, 0x18, 0xC3, 0xFF, 0xF0, 0xC3, 0x18,
   0xC6, 0x31, 0x84, 0x33, 0x18, 0xC6, 0x31, 0x98, 0x70, 0x24, 0xC1, 0xC0 };
 
-const GFXglyph FreeSerif9pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSerif9pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,   5,    0,    1 },   // 0x20 ' '
   {     0,   2,  12,   6,    2,  -11 },   // 0x21 '!'
   {     3,   5,   4,   7,    1,  -11 },   // 0x22 '"'
@@ -187,7 +187,7 @@ const GFXglyph FreeSerif9pt7bGlyphs[] PROGMEM = {
   {  1066,   5,  16,   9,    3,  -11 },   // 0x7D '}'
   {  1076,   9,   3,   9,    0,   -5 } }; // 0x7E '~'
 
-const GFXfont FreeSerif9pt7b PROGMEM = {
+constexpr GFXfont FreeSerif9pt7b PROGMEM = {
   (uint8_t  *)FreeSerif9pt7bBitmaps,
   (GFXglyph *)FreeSerif9pt7bGlyphs,
   0x20, 0x7E, 22 };
@@ -1,4 +1,4 @@
-const uint8_t FreeSerifBold12pt7bBitmaps[] PROGMEM = {
+constexpr uint8_t FreeSerifBold12pt7bBitmaps[] PROGMEM = {
   0x7F, 0xFF, 0x77, 0x66, 0x22, 0x00, 0x6F, 0xF7, 0xE3, 0xF1, 0xF8, 0xFC,
   0x7E, 0x3A, 0x09, 0x04, 0x0C, 0x40, 0xCC, 0x0C, 0xC0, 0x8C, 0x18, 0xC7,
   0xFF, 0x18, 0xC1, 0x88, 0x19, 0x81, 0x98, 0xFF, 0xE3, 0x18, 0x31, 0x83,
@@ -166,7 +166,7 @@ const uint8_t FreeSerifBold12pt7bBitmaps[] PROGMEM = {
   0x38, 0x38, 0x38, 0x38, 0x38, 0x18, 0x07, 0x38, 0x38, 0x38, 0x38, 0x38,
   0x38, 0x38, 0x38, 0x70, 0xE0, 0x70, 0x1F, 0x8B, 0x3F, 0x01, 0xC0 };
 
-const GFXglyph FreeSerifBold12pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSerifBold12pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,   6,    0,    1 },   // 0x20 ' '
   {     0,   4,  16,   8,    2,  -15 },   // 0x21 '!'
   {     8,   9,   7,  13,    2,  -15 },   // 0x22 '"'
@@ -263,7 +263,7 @@ const GFXglyph FreeSerifBold12pt7bGlyphs[] PROGMEM = {
   {  1964,   8,  21,   9,    2,  -16 },   // 0x7D '}'
   {  1985,  11,   4,  12,    1,   -7 } }; // 0x7E '~'
 
-const GFXfont FreeSerifBold12pt7b PROGMEM = {
+constexpr GFXfont FreeSerifBold12pt7b PROGMEM = {
   (uint8_t  *)FreeSerifBold12pt7bBitmaps,
   (GFXglyph *)FreeSerifBold12pt7bGlyphs,
   0x20, 0x7E, 29 };
@@ -1,4 +1,4 @@
-const uint8_t FreeSerifBold9pt7bBitmaps[] PROGMEM = {
+constexpr uint8_t FreeSerifBold9pt7bBitmaps[] PROGMEM = {
   0xFF, 0xF4, 0x92, 0x1F, 0xF0, 0xCF, 0x3C, 0xE3, 0x88, 0x13, 0x09, 0x84,
   0xC2, 0x47, 0xF9, 0x90, 0xC8, 0x4C, 0xFF, 0x13, 0x09, 0x0C, 0x86, 0x40,
   0x10, 0x38, 0xD6, 0x92, 0xD2, 0xF0, 0x7C, 0x3E, 0x17, 0x93, 0x93, 0xD6,
@@ -97,7 +97,7 @@ const uint8_t FreeSerifBold9pt7bBitmaps[] PROGMEM = {
   0x63, 0x18, 0xCC, 0x61, 0x8C, 0x63, 0x18, 0xC3, 0xFF, 0xF8, 0xC3, 0x18,
   0xC6, 0x31, 0x86, 0x33, 0x18, 0xC6, 0x31, 0x98, 0xF0, 0x8E };
 
-const GFXglyph FreeSerifBold9pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSerifBold9pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,   5,    0,    1 },   // 0x20 ' '
   {     0,   3,  12,   6,    1,  -11 },   // 0x21 '!'
   {     5,   6,   5,  10,    2,  -11 },   // 0x22 '"'
@@ -194,7 +194,7 @@ const GFXglyph FreeSerifBold9pt7bGlyphs[] PROGMEM = {
   {  1150,   5,  16,   7,    2,  -12 },   // 0x7D '}'
   {  1160,   8,   2,   9,    1,   -4 } }; // 0x7E '~'
 
-const GFXfont FreeSerifBold9pt7b PROGMEM = {
+constexpr GFXfont FreeSerifBold9pt7b PROGMEM = {
   (uint8_t  *)FreeSerifBold9pt7bBitmaps,
   (GFXglyph *)FreeSerifBold9pt7bGlyphs,
   0x20, 0x7E, 22 };
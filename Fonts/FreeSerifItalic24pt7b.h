@@ -1,4 +1,4 @@
-const uint8_t FreeSerifItalic24pt7bBitmaps[] PROGMEM = {
+constexpr uint8_t FreeSerifItalic24pt7bBitmaps[] PROGMEM = {
   0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x01, 0xF0, 0x1E, 0x01, 0xE0, 0x1C,
   0x01, 0xC0, 0x3C, 0x03, 0x80, 0x38, 0x03, 0x80, 0x30, 0x07, 0x00, 0x60,
   0x06, 0x00, 0x60, 0x04, 0x00, 0x40, 0x0C, 0x00, 0x80, 0x08, 0x00, 0x00,
@@ -632,7 +632,7 @@ const uint8_t FreeSerifItalic24pt7bBitmaps[] PROGMEM = {
   0xF8, 0x00, 0x1F, 0x80, 0x00, 0xFF, 0x80, 0xC7, 0xFF, 0x87, 0xBC, 0x3F,
   0xFE, 0x60, 0x3F, 0xF0, 0x00, 0x1F, 0x00 };
 
-const GFXglyph FreeSerifItalic24pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSerifItalic24pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,  12,    0,    1 },   // 0x20 ' '
   {     0,  12,  32,  16,    2,  -30 },   // 0x21 '!'
   {    48,  14,  12,  16,    6,  -31 },   // 0x22 '"'
@@ -729,7 +729,7 @@ const GFXglyph FreeSerifItalic24pt7bGlyphs[] PROGMEM = {
   {  7480,  16,  41,  19,    0,  -32 },   // 0x7D '}'
   {  7562,  22,   6,  25,    2,  -14 } }; // 0x7E '~'
 
-const GFXfont FreeSerifItalic24pt7b PROGMEM = {
+constexpr GFXfont FreeSerifItalic24pt7b PROGMEM = {
   (uint8_t  *)FreeSerifItalic24pt7bBitmaps,
   (GFXglyph *)FreeSerifItalic24pt7bGlyphs,
   0x20, 0x7E, 56 };
@@ -1,4 +1,4 @@
-const uint8_t FreeSerifItalic9pt7bBitmaps[] PROGMEM = {
+constexpr uint8_t FreeSerifItalic9pt7bBitmaps[] PROGMEM = {
   0x11, 0x12, 0x22, 0x24, 0x40, 0x0C, 0xDE, 0xE5, 0x40, 0x04, 0x82, 0x20,
   0x98, 0x24, 0x7F, 0xC4, 0x82, 0x23, 0xFC, 0x24, 0x11, 0x04, 0x83, 0x20,
   0x1C, 0x1B, 0x99, 0x4D, 0x26, 0x81, 0xC0, 0x70, 0x1C, 0x13, 0x49, 0xA4,
@@ -97,7 +97,7 @@ const uint8_t FreeSerifItalic9pt7bBitmaps[] PROGMEM = {
   0x30, 0xC3, 0x8F, 0x00, 0xFF, 0xF0, 0x1E, 0x0C, 0x10, 0x20, 0xC1, 0x82,
   0x04, 0x1C, 0x30, 0x40, 0x83, 0x04, 0x08, 0x20, 0x60, 0x99, 0x8E };
 
-const GFXglyph FreeSerifItalic9pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeSerifItalic9pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,   5,    0,    1 },   // 0x20 ' '
   {     0,   4,  12,   6,    1,  -11 },   // 0x21 '!'
   {     6,   5,   4,   6,    3,  -11 },   // 0x22 '"'
@@ -194,7 +194,7 @@ const GFXglyph FreeSerifItalic9pt7bGlyphs[] PROGMEM = {
   {  1146,   7,  16,   7,    0,  -12 },   // 0x7D '}'
   {  1160,   8,   3,  10,    1,   -5 } }; // 0x7E '~'
 
-const GFXfont FreeSerifItalic9pt7b PROGMEM = {
+constexpr GFXfont FreeSerifItalic9pt7b PROGMEM = {
   (uint8_t  *)FreeSerifItalic9pt7bBitmaps,
   (GFXglyph *)FreeSerifItalic9pt7bGlyphs,
   0x20, 0x7E, 22 };
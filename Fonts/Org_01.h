@@ -1,7 +1,7 @@
 // Org_v01 by Orgdot (www.orgdot.com/aliasfonts).  A tiny,
 // stylized font with all characters within a 6 pixel height.
 
-const uint8_t Org_01Bitmaps[] PROGMEM = {
+constexpr uint8_t Org_01Bitmaps[] PROGMEM = {
   0xE8, 0xA0, 0x57, 0xD5, 0xF5, 0x00, 0xFD, 0x3E, 0x5F, 0x80, 0x88, 0x88,
   0x88, 0x80, 0xF4, 0xBF, 0x2E, 0x80, 0x80, 0x6A, 0x40, 0x95, 0x80, 0xAA,
   0x80, 0x5D, 0x00, 0xC0, 0xF0, 0x80, 0x08, 0x88, 0x88, 0x00, 0xFC, 0x63,
@@ -26,7 +26,7 @@ const uint8_t Org_01Bitmaps[] PROGMEM = {
   0x99, 0x97, 0x8C, 0x6B, 0xF0, 0x96, 0x69, 0x99, 0x9F, 0x10, 0x2E, 0x8F,
   0x2B, 0x22, 0xF8, 0x89, 0xA8, 0x0F, 0xE0 };
 
-const GFXglyph Org_01Glyphs[] PROGMEM = {
+constexpr GFXglyph Org_01Glyphs[] PROGMEM = {
   {     0,   0,   0,   6,    0,    1 },   // 0x20 ' '
   {     0,   1,   5,   2,    0,   -4 },   // 0x21 '!'
   {     1,   3,   1,   4,    0,   -4 },   // 0x22 '"'
@@ -123,7 +123,7 @@ const GFXglyph Org_01Glyphs[] PROGMEM = {
   {   267,   3,   5,   4,    0,   -4 },   // 0x7D '}'
   {   269,   5,   3,   6,    0,   -3 } }; // 0x7E '~'
 
-const GFXfont Org_01 PROGMEM = {
+constexpr GFXfont Org_01 PROGMEM = {
   (uint8_t  *)Org_01Bitmaps,
   (GFXglyph *)Org_01Glyphs,
   0x20, 0x7E, 7 };
@@ -1,7 +1,7 @@
 // Picopixel by Sebastian Weber.  A tiny font
 // with all characters within a 6 pixel height.
 
-const uint8_t PicopixelBitmaps[] PROGMEM = {
+constexpr uint8_t PicopixelBitmaps[] PROGMEM = {
   0xE8, 0xB4, 0x57, 0xD5, 0xF5, 0x00, 0x4E, 0x3E, 0x80, 0xA5, 0x4A, 0x4A,
   0x5A, 0x50, 0xC0, 0x6A, 0x40, 0x95, 0x80, 0xAA, 0x80, 0x5D, 0x00, 0x60,
   0xE0, 0x80, 0x25, 0x48, 0x56, 0xD4, 0x75, 0x40, 0xC5, 0x4E, 0xC5, 0x1C,
@@ -18,7 +18,7 @@ const uint8_t PicopixelBitmaps[] PROGMEM = {
   0x90, 0xE8, 0x71, 0xE0, 0xBA, 0x40, 0xB5, 0x80, 0xB5, 0x00, 0x8D, 0x54,
   0xAA, 0x80, 0xAC, 0xE0, 0xE5, 0x70, 0x6A, 0x26, 0xFC, 0xC8, 0xAC, 0x5A };
 
-const GFXglyph PicopixelGlyphs[] PROGMEM = {
+constexpr GFXglyph PicopixelGlyphs[] PROGMEM = {
   {     0,   0,   0,   2,    0,    1 },   // 0x20 ' '
   {     0,   1,   5,   2,    0,   -4 },   // 0x21 '!'
   {     1,   3,   2,   4,    0,   -4 },   // 0x22 '"'
@@ -115,7 +115,7 @@ const GFXglyph PicopixelGlyphs[] PROGMEM = {
   {   177,   3,   5,   4,    0,   -4 },   // 0x7D '}'
   {   179,   4,   2,   5,    0,   -3 } }; // 0x7E '~'
 
-const GFXfont Picopixel PROGMEM = {
+constexpr GFXfont Picopixel PROGMEM = {
   (uint8_t  *)PicopixelBitmaps,
   (GFXglyph *)PicopixelGlyphs,
   0x20, 0x7E, 7 };
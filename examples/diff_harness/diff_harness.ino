@@ -0,0 +1,441 @@
+/***************************************************
+  Differential test and benchmark of the optimized drawing paths.
+
+  Runs randomized sequences of primitives (all four rotations, off-screen
+  coordinates, negative sizes, fonts and bitmaps) on a reference canvas
+  that only implements drawPixel(), so every primitive takes the generic
+  per-pixel path of Adafruit_GFX, and on the targets with fast paths. The
+  pixels are compared after every primitive; a mismatch is reported with
+  seed, rotation and the call that caused it. Afterwards every primitive is
+  timed on the reference and on GFXcanvas16 and the speedup is printed.
+
+  Needs no display, so it also runs on a PC: compile it together with the
+  library sources and a main() calling setup(). PC builds also compare
+  GFXbandRenderer with the serial replay of the display list, and
+  Adafruit_SPITFT by decoding the bytes it sends: their SPI.h stub has to
+  keep the bytes written in a std::vector<uint8_t> data member of SPIClass.
+
+  BSD license, all text above must be included in any redistribution
+ ****************************************************/
+
+#include "Adafruit_GFX.h"
+#include "Adafruit_GFX_BandRenderer.h"
+#include "Adafruit_GFX_DisplayList.h"
+#include "Adafruit_GFX_Path.h"
+#include "Adafruit_GFX_Region.h"
+#include "Adafruit_GFX_TiledCanvas.h"
+#include "Fonts/FreeMono9pt7b.h"
+
+#if defined(__linux__) || defined(__APPLE__) || defined(_WIN32)
+#define HOST_BUILD 1
+#include "Adafruit_SPITFT.h"
+#else
+#define HOST_BUILD 0
+#endif
+
+static constexpr gfx_coord_t WIDTH { 96 };
+static constexpr gfx_coord_t HEIGHT { 64 };
+static constexpr uint16_t SEQUENCES { 200 }; // random sequences per rotation
+static constexpr uint16_t SEQUENCE_LENGTH { 20 }; // primitives per sequence
+static constexpr uint16_t BENCH_CALLS { 500 }; // calls per primitive for the timing
+
+// Reference targets: only drawPixel(), with the same buffer layout as the canvases
+class ReferenceCanvas16 : public Adafruit_GFX {
+public:
+  ReferenceCanvas16(gfx_coord_t w, gfx_coord_t h) : Adafruit_GFX(w, h), buffer(new uint16_t[w * h]()) {}
+  ~ReferenceCanvas16() { delete[] buffer; }
+
+  void drawPixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) override {
+    if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return;
+    buffer[raw(x, y)] = color;
+  }
+
+  // Anti-aliased spans blend pixel by pixel, like the canvas
+  void writeFastHLineAlpha(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color, uint8_t alpha) override {
+    if (alpha == 255) {
+      writeFastHLine(x, y, w, color);
+      return;
+    }
+    if ((y < 0) || (y >= _height)) return;
+    for (gfx_coord_t i = std::max<gfx_coord_t>(x, 0); i < x + w && i < _width; i++) {
+      drawPixel(i, y, blend565(color, getPixel(i, y), alpha));
+    }
+  }
+
+  uint16_t getPixel(gfx_coord_t x, gfx_coord_t y) const { return buffer[raw(x, y)]; }
+
+  uint16_t* buffer;
+
+private:
+  size_t raw(gfx_coord_t x, gfx_coord_t y) const {
+    switch (rotation) {
+      case 1: return (WIDTH - 1 - y) + x * static_cast<size_t>(WIDTH);
+      case 2: return (WIDTH - 1 - x) + (HEIGHT - 1 - y) * static_cast<size_t>(WIDTH);
+      case 3: return y + (HEIGHT - 1 - x) * static_cast<size_t>(WIDTH);
+      default: return x + y * static_cast<size_t>(WIDTH);
+    }
+  }
+};
+
+class ReferenceCanvas8 : public Adafruit_GFX {
+public:
+  ReferenceCanvas8(gfx_coord_t w, gfx_coord_t h) : Adafruit_GFX(w, h), buffer(new uint8_t[w * h]()) {}
+  ~ReferenceCanvas8() { delete[] buffer; }
+
+  void drawPixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) override {
+    if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return;
+    gfx_coord_t t;
+    switch (rotation) {
+      case 1: t = x; x = WIDTH - 1 - y; y = t; break;
+      case 2: x = WIDTH - 1 - x; y = HEIGHT - 1 - y; break;
+      case 3: t = x; x = y; y = HEIGHT - 1 - t; break;
+    }
+    buffer[x + y * static_cast<size_t>(WIDTH)] = color;
+  }
+
+  void writeFastHLineAlpha(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color, uint8_t alpha) override {
+    if (alpha == 255) {
+      writeFastHLine(x, y, w, color);
+      return;
+    }
+    if ((y < 0) || (y >= _height)) return;
+    for (gfx_coord_t i = std::max<gfx_coord_t>(x, 0); i < x + w && i < _width; i++) {
+      const int16_t fg = color & 0xff, bg = getPixel(i, y);
+      drawPixel(i, y, bg + ((fg - bg) * alpha + 127) / 255);
+    }
+  }
+
+  uint8_t getPixel(gfx_coord_t x, gfx_coord_t y) const {
+    gfx_coord_t t;
+    switch (rotation) {
+      case 1: t = x; x = WIDTH - 1 - y; y = t; break;
+      case 2: x = WIDTH - 1 - x; y = HEIGHT - 1 - y; break;
+      case 3: t = x; x = y; y = HEIGHT - 1 - t; break;
+    }
+    return buffer[x + y * static_cast<size_t>(WIDTH)];
+  }
+
+  uint8_t* buffer;
+};
+
+#if HOST_BUILD
+// Display without a panel: decodes the address window protocol of an ILI9341 from the bytes recorded by the SPI stub
+class DecodingTFT : public Adafruit_SPITFT {
+public:
+  DecodingTFT(gfx_coord_t w, gfx_coord_t h) : Adafruit_SPITFT(w, h, -1, -1), buffer(new uint16_t[w * h]()) {}
+  ~DecodingTFT() { delete[] buffer; }
+
+  void begin(uint32_t) override {}
+
+  void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) const override {
+    decode();
+    writeCommand(0x2A); // CASET
+    SPI_WRITE32((static_cast<uint32_t>(x) << 16) | (x + w - 1));
+    writeCommand(0x2B); // PASET
+    SPI_WRITE32((static_cast<uint32_t>(y) << 16) | (y + h - 1));
+    writeCommand(0x2C); // RAMWR
+  }
+
+  // Panels with read back blend anti-aliased spans like the canvas, emulated from the decoded pixels
+  void writeFastHLineAlpha(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color, uint8_t alpha) override {
+    if (alpha == 255) {
+      writeFastHLine(x, y, w, color);
+      return;
+    }
+    if (!alpha || (y < 0) || (y >= _height)) return;
+    for (gfx_coord_t i = std::max<gfx_coord_t>(x, 0); i < x + w && i < _width; i++) {
+      decode();
+      writePixel(i, y, blend565(color, getPixel(i, y), alpha));
+    }
+  }
+
+  // Write the pixels sent since the last call into the buffer: CASET, PASET and RAMWR, then the data of the window
+  void decode() const {
+    std::vector<uint8_t>& data = SPI.data;
+    if ((data.size() >= 11) && (data[0] == 0x2A) && (data[5] == 0x2B) && (data[10] == 0x2C)) {
+      const uint16_t x1 = data[1] << 8 | data[2], x2 = data[3] << 8 | data[4];
+      const uint16_t y1 = data[6] << 8 | data[7], y2 = data[8] << 8 | data[9];
+      uint16_t x = x1, y = y1;
+      for (size_t i = 11; i + 1 < data.size(); i += 2) {
+        if ((x < _width) && (y < _height)) buffer[x + y * static_cast<size_t>(_width)] = data[i] << 8 | data[i + 1];
+        if (++x > x2) {
+          x = x1;
+          if (++y > y2) y = y1;
+        }
+      }
+    } // anything else isn't the expected protocol, its pixels are missing in the comparison
+    data.clear();
+  }
+
+  uint16_t getPixel(gfx_coord_t x, gfx_coord_t y) const { return buffer[x + y * static_cast<size_t>(_width)]; }
+
+  uint16_t* buffer;
+};
+#endif
+
+// Small deterministic PRNG, so a failing seed reproduces on every platform
+static uint32_t rng_state;
+static uint32_t next() {
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 17;
+  rng_state ^= rng_state << 5;
+  return rng_state;
+}
+static int32_t range(int32_t lo, int32_t hi) { return lo + static_cast<int32_t>(next() % static_cast<uint32_t>(hi - lo + 1)); }
+static gfx_coord_t coordX() { return range(-WIDTH / 2, WIDTH + WIDTH / 2); }
+static gfx_coord_t coordY() { return range(-HEIGHT / 2, HEIGHT + HEIGHT / 2); }
+static gfx_coord_t size() { return range(-8, WIDTH); } // negative and zero sizes included
+
+static const uint8_t mono_bitmap[] = { 0xf0, 0x0f, 0xaa, 0x55, 0x3c, 0xc3, 0x18, 0x81, 0xff, 0x00, 0x66, 0x99 };
+static const uint8_t gray_bitmap[6 * 5] = { 0, 10, 20, 30, 40, 50, 60, 70, 80, 90, 100, 110, 120, 130, 140,
+                                            150, 160, 170, 180, 190, 200, 210, 220, 230, 240, 250, 255, 1, 2, 3 };
+static uint16_t rgb_bitmap[12 * 7];
+
+enum Primitive : uint8_t {
+  PIXEL, HLINE, VLINE, FILL_RECT, RECT, LINE, CIRCLE, FILL_CIRCLE, ROUND_RECT, FILL_ROUND_RECT, TRIANGLE,
+  FILL_TRIANGLE, QUAD_BEZIER, CUBIC_BEZIER, BITMAP, GRAY_BITMAP, RGB_BITMAP, PATH, TEXT, FONT_TEXT, PRIMITIVES
+};
+
+static const char* const names[PRIMITIVES] = {
+  "drawPixel", "drawFastHLine", "drawFastVLine", "fillRect", "drawRect", "drawLine", "drawCircle", "fillCircle",
+  "drawRoundRect", "fillRoundRect", "drawTriangle", "fillTriangle", "drawQuadBezier", "drawCubicBezier",
+  "drawBitmap", "drawGrayscaleBitmap", "drawRGBBitmap", "GFXpath::fill", "print", "print (GFXfont)"
+};
+
+// A primitive with random parameters, drawn identically to every target
+struct Call {
+  Primitive primitive;
+  gfx_coord_t v[8];
+  uint16_t color;
+
+  static Call random(Primitive p) {
+    Call c { p, {}, static_cast<uint16_t>(next()) };
+    c.v[0] = coordX(); c.v[1] = coordY(); c.v[2] = size(); c.v[3] = size();
+    c.v[4] = coordX(); c.v[5] = coordY(); c.v[6] = coordX(); c.v[7] = coordY();
+    return c;
+  }
+
+  void draw(Adafruit_GFX& gfx) const {
+    switch (primitive) {
+      case PIXEL: gfx.drawPixel(v[0], v[1], color); break;
+      case HLINE: gfx.drawFastHLine(v[0], v[1], v[2], color); break;
+      case VLINE: gfx.drawFastVLine(v[0], v[1], v[3], color); break;
+      case FILL_RECT: gfx.fillRect(v[0], v[1], v[2], v[3], color); break;
+      case RECT: gfx.drawRect(v[0], v[1], v[2], v[3], color); break;
+      case LINE: gfx.drawLine(v[0], v[1], v[4], v[5], color); break;
+      case CIRCLE: gfx.drawCircle(v[0], v[1], abs(v[2]) / 2, color); break;
+      case FILL_CIRCLE: gfx.fillCircle(v[0], v[1], abs(v[2]) / 2, color); break;
+      case ROUND_RECT: gfx.drawRoundRect(v[0], v[1], v[2], v[3], abs(v[4]) / 8, color); break;
+      case FILL_ROUND_RECT: gfx.fillRoundRect(v[0], v[1], v[2], v[3], abs(v[4]) / 8, color); break;
+      case TRIANGLE: gfx.drawTriangle(v[0], v[1], v[4], v[5], v[6], v[7], color); break;
+      case FILL_TRIANGLE: gfx.fillTriangle(v[0], v[1], v[4], v[5], v[6], v[7], color); break;
+      case QUAD_BEZIER: gfx.drawQuadBezier(v[0], v[1], v[4], v[5], v[6], v[7], color); break;
+      case CUBIC_BEZIER: gfx.drawCubicBezier(v[0], v[1], v[4], v[5], v[6], v[7], v[2], v[3], color); break;
+      case BITMAP: gfx.drawBitmap(v[0], v[1], mono_bitmap, 16, 6, color, ~color); break;
+      case GRAY_BITMAP: gfx.drawGrayscaleBitmap(v[0], v[1], gray_bitmap, 6, 5); break;
+      case RGB_BITMAP: gfx.drawRGBBitmap(v[0], v[1], rgb_bitmap, 12, 7); break;
+      case PATH: {
+        GFXpath path(64);
+        path.moveTo(v[0], v[1]);
+        path.lineTo(v[4], v[5]);
+        path.quadTo(v[6], v[7], v[0] + v[2], v[1] + v[3]);
+        path.close();
+        path.fill(gfx, 0, 0, color, (color & 1) ? GFXpath::FillRule::EvenOdd : GFXpath::FillRule::NonZero);
+        break;
+      }
+      case TEXT:
+      case FONT_TEXT:
+        gfx.setFont(primitive == FONT_TEXT ? &FreeMono9pt7b : nullptr);
+        gfx.setTextSize(1 + (color & 1));
+        gfx.setTextWrap(color & 4);
+        gfx.setTextColor(color, (color & 8) ? color ^ 0xffff : color);
+        gfx.setCursor(v[0], v[1]);
+        gfx.print("Gfx 0123!");
+        gfx.setFont(nullptr);
+        break;
+      default: break;
+    }
+  }
+
+  // Adafruit_SPITFT takes negative sizes as extending left or up and draws nothing for zero sizes, unlike the generic
+  // implementation; round rectangles smaller than twice their radius have negative inner sizes
+  bool spitftDiffers() const {
+    const gfx_coord_t r = abs(v[4]) / 8;
+    switch (primitive) {
+      case HLINE: return v[2] <= 0;
+      case VLINE: return v[3] <= 0;
+      case FILL_RECT:
+      case RECT: return (v[2] <= 0) || (v[3] <= 0);
+      case ROUND_RECT:
+      case FILL_ROUND_RECT: return (v[2] <= 2 * r) || (v[3] <= 2 * r);
+      default: return false;
+    }
+  }
+
+  void print() const {
+    Serial.print(names[primitive]);
+    Serial.print('(');
+    for (uint8_t i = 0; i < 8; i++) {
+      Serial.print(v[i]);
+      Serial.print(i < 7 ? ", " : ") color ");
+    }
+    Serial.println(color, HEX);
+  }
+};
+
+// Optimized targets, each compared with the matching reference
+static GFXcanvas16 canvas16(WIDTH, HEIGHT);
+static GFXcanvas16 canvas16be(WIDTH, HEIGHT, true); // big-endian storage, compared through getPixel()
+static GFXcanvas8 canvas8(WIDTH, HEIGHT);
+static GFXtiledCanvas16 tiled(WIDTH, HEIGHT, (WIDTH / 16 + 1) * (HEIGHT / 16 + 1));
+static GFXcanvas16 clipped(WIDTH, HEIGHT);
+static GFXcanvas16 replayed(WIDTH, HEIGHT);
+static GFXdisplayList recorder(WIDTH, HEIGHT, 4096);
+#if HOST_BUILD
+static DecodingTFT tft(WIDTH, HEIGHT);
+#endif
+#if ADAFRUIT_GFX_HOST_THREADS
+static GFXcanvas16 banded(WIDTH, HEIGHT);
+static GFXbandRenderer bands(4, 8); // more bands than threads, so they're stolen as well
+#endif
+static ReferenceCanvas16 reference16(WIDTH, HEIGHT);
+static ReferenceCanvas8 reference8(WIDTH, HEIGHT);
+static GFXregion<1> full(0, 0, 1024, 1024);
+
+static uint32_t failures;
+
+static void fail(const char* target, uint32_t seed, uint8_t rotation, const Call& call, gfx_coord_t x, gfx_coord_t y) {
+  if (++failures > 20) return;
+  Serial.print(target);
+  Serial.print(" differs at (");
+  Serial.print(x);
+  Serial.print(", ");
+  Serial.print(y);
+  Serial.print("), seed ");
+  Serial.print(seed);
+  Serial.print(" rotation ");
+  Serial.print(rotation);
+  Serial.print(" after ");
+  call.print();
+}
+
+// Compare all targets with the references, returns false on the first mismatch
+static bool compare(uint32_t seed, uint8_t rotation, const Call& call) {
+  recorder.replay(replayed);
+#if ADAFRUIT_GFX_HOST_THREADS
+  bands.render(recorder, banded);
+#endif
+  recorder.clear();
+#if HOST_BUILD
+  tft.decode();
+  const bool compare_tft = !call.spitftDiffers(); // otherwise it's synchronized with the reference
+#endif
+  for (gfx_coord_t y = 0; y < reference16.height(); y++) {
+    for (gfx_coord_t x = 0; x < reference16.width(); x++) {
+      const uint16_t expected = reference16.getPixel(x, y);
+      const char* target = nullptr;
+      if (canvas16.getPixel(x, y) != expected) target = "GFXcanvas16";
+      else if (canvas16be.getPixel(x, y) != expected) target = "GFXcanvas16 (big-endian)";
+      else if (tiled.getPixel(x, y) != expected) target = "GFXtiledCanvas16";
+      else if (clipped.getPixel(x, y) != expected) target = "GFXclipView";
+      else if (replayed.getPixel(x, y) != expected) target = "GFXdisplayList";
+#if ADAFRUIT_GFX_HOST_THREADS
+      else if (banded.getPixel(x, y) != expected) target = "GFXbandRenderer";
+#endif
+#if HOST_BUILD
+      else if (compare_tft && (tft.getPixel(x, y) != expected)) target = "Adafruit_SPITFT";
+      if (!compare_tft) tft.buffer[x + y * static_cast<size_t>(tft.width())] = expected;
+#endif
+      if (target) {
+        fail(target, seed, rotation, call, x, y);
+        return false;
+      }
+    }
+  }
+  if (memcmp(canvas8.getBuffer(), reference8.buffer, WIDTH * HEIGHT)) {
+    fail("GFXcanvas8", seed, rotation, call, -1, -1);
+    return false;
+  }
+  return true;
+}
+
+static void differentialTest() {
+  Adafruit_GFX* const targets[] = { &canvas16, &canvas16be, &canvas8, &tiled, &clipped, &replayed, &recorder, &reference16, &reference8,
+#if HOST_BUILD
+                                     &tft,
+#endif
+#if ADAFRUIT_GFX_HOST_THREADS
+                                     &banded,
+#endif
+  };
+
+  for (uint8_t rotation = 0; rotation < 4; rotation++) {
+    for (auto* t : targets) {
+      t->setRotation(rotation);
+      t->fillScreen(0);
+    }
+    GFXclipView clip(clipped, full); // takes the size of the rotated target
+    recorder.clear();
+
+    for (uint32_t seed = 1; seed <= SEQUENCES; seed++) {
+      rng_state = seed * 2654435761u;
+      for (uint16_t i = 0; i < SEQUENCE_LENGTH; i++) {
+        const Call call = Call::random(static_cast<Primitive>(next() % PRIMITIVES));
+        for (Adafruit_GFX* t : { static_cast<Adafruit_GFX*>(&canvas16), static_cast<Adafruit_GFX*>(&canvas16be), static_cast<Adafruit_GFX*>(&canvas8),
+                                 static_cast<Adafruit_GFX*>(&tiled), static_cast<Adafruit_GFX*>(&clip), static_cast<Adafruit_GFX*>(&recorder),
+                                 static_cast<Adafruit_GFX*>(&reference16), static_cast<Adafruit_GFX*>(&reference8),
+#if HOST_BUILD
+                                 static_cast<Adafruit_GFX*>(&tft),
+#endif
+                               }) {
+          t->setCursor(0, 0);
+          call.draw(*t);
+        }
+        if (!compare(seed, rotation, call)) {
+          // Start over from identical buffers
+          for (auto* t : targets) t->fillScreen(0);
+        }
+      }
+    }
+  }
+}
+
+static uint32_t timeCalls(Adafruit_GFX& gfx, Primitive p) {
+  rng_state = 12345;
+  const uint32_t start = micros();
+  for (uint16_t i = 0; i < BENCH_CALLS; i++) {
+    Call::random(p).draw(gfx);
+  }
+  return micros() - start;
+}
+
+static void benchmark() {
+  Serial.println(F("Primitive                reference us  GFXcanvas16 us  speedup"));
+  reference16.setRotation(0);
+  canvas16.setRotation(0);
+  for (uint8_t p = 0; p < PRIMITIVES; p++) {
+    const uint32_t ref = timeCalls(reference16, static_cast<Primitive>(p));
+    const uint32_t opt = timeCalls(canvas16, static_cast<Primitive>(p));
+    Serial.print(names[p]);
+    for (int16_t pad = 25 - strlen(names[p]); pad > 0; pad--) Serial.print(' ');
+    Serial.print(ref);
+    Serial.print(F("\t\t"));
+    Serial.print(opt);
+    Serial.print(F("\t\t"));
+    Serial.println(opt ? static_cast<double>(ref) / opt : 0.0, 2);
+  }
+}
+
+void setup() {
+  Serial.begin(115200);
+  for (uint16_t i = 0; i < sizeof(rgb_bitmap) / sizeof(rgb_bitmap[0]); i++) rgb_bitmap[i] = i * 0x0841;
+
+  differentialTest();
+  Serial.print(F("Differential test: "));
+  Serial.print(failures);
+  Serial.println(F(" mismatches"));
+
+  benchmark();
+}
+
+void loop() {}
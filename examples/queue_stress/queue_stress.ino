@@ -0,0 +1,112 @@
+/***************************************************
+  Stress test of the Coalesce policy of the draw command queues.
+
+  Producer threads post strictly increasing values per widget id (one
+  producer per widget, as Coalesce requires) as fast as they can, while the
+  consumer takes them out and checks that every widget's values keep
+  increasing: a value delivered twice, or an older one after a newer one,
+  is reported. When the producers are done, the consumer must end with the
+  last value of every widget, no update may be lost for good.
+
+  Needs threads, so it runs on a PC only: compile it together with the
+  library sources and a main() calling setup(). Build with
+  -fsanitize=thread to check the memory ordering as well.
+
+  BSD license, all text above must be included in any redistribution
+ ****************************************************/
+
+#include "Adafruit_GFX.h"
+#include "Adafruit_GFX_CommandQueue.h"
+
+#if defined(__linux__) || defined(__APPLE__) || defined(_WIN32)
+#include <atomic>
+#include <thread>
+#include <vector>
+
+static constexpr uint8_t WIDGETS { 4 };
+static constexpr uint32_t UPDATES { 2000000 }; // values posted per widget
+
+// A widget's value, spread over two coordinates so it doesn't wrap
+static GFXdisplayList::Command encode(uint32_t value) {
+  return { GFXdisplayList::Op::Pixel, 255, 0, static_cast<gfx_coord_t>(value & 0xffff), static_cast<gfx_coord_t>(value >> 16), 0, 0 };
+}
+
+static uint32_t decode(const GFXdisplayList::Command& cmd) {
+  return static_cast<uint16_t>(cmd.x) | (static_cast<uint32_t>(static_cast<uint16_t>(cmd.y)) << 16);
+}
+
+// Runs producers against one queue, returns the number of errors
+template <typename Queue>
+static uint32_t stress(const char* name, Queue& queue, uint8_t producers) {
+  std::atomic<uint8_t> running { producers };
+  std::vector<std::thread> threads;
+  for (uint8_t p = 0; p < producers; p++) {
+    threads.emplace_back([&queue, &running, p, producers]() {
+      for (uint32_t v = 1; v <= UPDATES; v++) {
+        for (uint8_t w = 1 + p; w <= WIDGETS; w += producers) queue.post(encode(v), w);
+      }
+      running.fetch_sub(1);
+    });
+  }
+
+  uint32_t last[WIDGETS + 1] = {};
+  uint32_t errors = 0, taken = 0;
+  auto check = [&](const GFXdisplayList::Command& cmd, uint8_t widget) {
+    const uint32_t value = decode(cmd);
+    if ((widget < 1) || (widget > WIDGETS) || (value <= last[widget])) {
+      if (++errors <= 10) {
+        Serial.print(name);
+        Serial.print(": widget ");
+        Serial.print(widget);
+        Serial.print(" got ");
+        Serial.print(value);
+        Serial.print(" after ");
+        Serial.println(value <= last[widget] ? last[widget] : 0);
+      }
+    } else {
+      last[widget] = value;
+    }
+    taken++;
+  };
+  while (running.load()) queue.dispatch(check);
+  for (auto& t : threads) t.join();
+  queue.dispatch(check);
+
+  for (uint8_t w = 1; w <= WIDGETS; w++) {
+    if (last[w] != UPDATES) {
+      errors++;
+      Serial.print(name);
+      Serial.print(": widget ");
+      Serial.print(w);
+      Serial.print(" ended at ");
+      Serial.println(last[w]);
+    }
+  }
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print(taken);
+  Serial.print(" taken, ");
+  Serial.print(queue.coalesced());
+  Serial.print(" coalesced, ");
+  Serial.print(errors);
+  Serial.println(" errors");
+  return errors;
+}
+
+void setup() {
+  Serial.begin(115200);
+  static GFXcommandRing<8, WIDGETS> ring(GFXoverflow::Coalesce);
+  static GFXcommandQueue<8, WIDGETS> queue(GFXoverflow::Coalesce);
+  const uint32_t errors = stress("GFXcommandRing", ring, 1) + stress("GFXcommandQueue", queue, WIDGETS);
+  Serial.print(F("Coalesce stress test: "));
+  Serial.print(errors);
+  Serial.println(F(" errors"));
+}
+#else
+void setup() {
+  Serial.begin(115200);
+  Serial.println(F("This test needs threads, run it on a PC"));
+}
+#endif
+
+void loop() {}
@@ -0,0 +1,339 @@
+/***************************************************
+  Text rendering benchmark across all bundled fonts.
+
+  Renders digits, mixed text and a wrapped paragraph with the classic font
+  and every font in Fonts/ at text sizes 1 to 4, into a GFXcanvas1, a
+  GFXcanvas16 and a mock SPI display, and prints per font and size:
+  - glyphs/s and pixels/s, timed with micros()
+  - spans/glyph: low-level calls (pixel, line or rect writes) per glyph
+  - SPI bytes/glyph: commands and data sent to the mock display per glyph
+
+  The mock display sends the address window commands of an ILI9341 but
+  needs no display, so the benchmark also runs on a PC: compile it together
+  with the library sources and a main() calling setup(). SPI bytes are only
+  counted if the library is built with -DADAFRUIT_GFX_SPITFT_STATS=1 (for
+  the whole build, not only this sketch), otherwise "n/a" is printed. With
+  them a GFXbusModel predicts the bus time of one screen of text on the
+  device, adjust its costs to the board.
+
+  BSD license, all text above must be included in any redistribution
+ ****************************************************/
+
+#include "SPI.h"
+#include "Adafruit_GFX.h"
+#include "Adafruit_SPITFT.h"
+#include "Adafruit_GFX_BusModel.h"
+#include "Fonts/FreeMono12pt7b.h"
+#include "Fonts/FreeMono18pt7b.h"
+#include "Fonts/FreeMono24pt7b.h"
+#include "Fonts/FreeMono9pt7b.h"
+#include "Fonts/FreeMonoBold12pt7b.h"
+#include "Fonts/FreeMonoBold18pt7b.h"
+#include "Fonts/FreeMonoBold24pt7b.h"
+#include "Fonts/FreeMonoBold9pt7b.h"
+#include "Fonts/FreeMonoBoldOblique12pt7b.h"
+#include "Fonts/FreeMonoBoldOblique18pt7b.h"
+#include "Fonts/FreeMonoBoldOblique24pt7b.h"
+#include "Fonts/FreeMonoBoldOblique9pt7b.h"
+#include "Fonts/FreeMonoOblique12pt7b.h"
+#include "Fonts/FreeMonoOblique18pt7b.h"
+#include "Fonts/FreeMonoOblique24pt7b.h"
+#include "Fonts/FreeMonoOblique9pt7b.h"
+#include "Fonts/FreeSans12pt7b.h"
+#include "Fonts/FreeSans18pt7b.h"
+#include "Fonts/FreeSans24pt7b.h"
+#include "Fonts/FreeSans9pt7b.h"
+#include "Fonts/FreeSansBold12pt7b.h"
+#include "Fonts/FreeSansBold18pt7b.h"
+#include "Fonts/FreeSansBold24pt7b.h"
+#include "Fonts/FreeSansBold9pt7b.h"
+#include "Fonts/FreeSansBoldOblique12pt7b.h"
+#include "Fonts/FreeSansBoldOblique18pt7b.h"
+#include "Fonts/FreeSansBoldOblique24pt7b.h"
+#include "Fonts/FreeSansBoldOblique9pt7b.h"
+#include "Fonts/FreeSansOblique12pt7b.h"
+#include "Fonts/FreeSansOblique18pt7b.h"
+#include "Fonts/FreeSansOblique24pt7b.h"
+#include "Fonts/FreeSansOblique9pt7b.h"
+#include "Fonts/FreeSerif12pt7b.h"
+#include "Fonts/FreeSerif18pt7b.h"
+#include "Fonts/FreeSerif24pt7b.h"
+#include "Fonts/FreeSerif9pt7b.h"
+#include "Fonts/FreeSerifBold12pt7b.h"
+#include "Fonts/FreeSerifBold18pt7b.h"
+#include "Fonts/FreeSerifBold24pt7b.h"
+#include "Fonts/FreeSerifBold9pt7b.h"
+#include "Fonts/FreeSerifBoldItalic12pt7b.h"
+#include "Fonts/FreeSerifBoldItalic18pt7b.h"
+#include "Fonts/FreeSerifBoldItalic24pt7b.h"
+#include "Fonts/FreeSerifBoldItalic9pt7b.h"
+#include "Fonts/FreeSerifItalic12pt7b.h"
+#include "Fonts/FreeSerifItalic18pt7b.h"
+#include "Fonts/FreeSerifItalic24pt7b.h"
+#include "Fonts/FreeSerifItalic9pt7b.h"
+#include "Fonts/Org_01.h"
+#include "Fonts/Picopixel.h"
+#include "Fonts/Tiny3x3a2pt7b.h"
+#include "Fonts/TomThumb.h"
+
+#define TFT_DC 9
+#define TFT_CS 10
+
+static constexpr gfx_coord_t WIDTH { 240 };
+static constexpr gfx_coord_t HEIGHT { 320 };
+static constexpr uint8_t REPEATS { 4 }; // renderings of every string per measurement
+
+struct Font {
+  const char* name;
+  const GFXfont* font;
+};
+
+static const Font fonts[] = {
+  { "classic", nullptr },
+  { "FreeMono12pt7b", &FreeMono12pt7b },
+  { "FreeMono18pt7b", &FreeMono18pt7b },
+  { "FreeMono24pt7b", &FreeMono24pt7b },
+  { "FreeMono9pt7b", &FreeMono9pt7b },
+  { "FreeMonoBold12pt7b", &FreeMonoBold12pt7b },
+  { "FreeMonoBold18pt7b", &FreeMonoBold18pt7b },
+  { "FreeMonoBold24pt7b", &FreeMonoBold24pt7b },
+  { "FreeMonoBold9pt7b", &FreeMonoBold9pt7b },
+  { "FreeMonoBoldOblique12pt7b", &FreeMonoBoldOblique12pt7b },
+  { "FreeMonoBoldOblique18pt7b", &FreeMonoBoldOblique18pt7b },
+  { "FreeMonoBoldOblique24pt7b", &FreeMonoBoldOblique24pt7b },
+  { "FreeMonoBoldOblique9pt7b", &FreeMonoBoldOblique9pt7b },
+  { "FreeMonoOblique12pt7b", &FreeMonoOblique12pt7b },
+  { "FreeMonoOblique18pt7b", &FreeMonoOblique18pt7b },
+  { "FreeMonoOblique24pt7b", &FreeMonoOblique24pt7b },
+  { "FreeMonoOblique9pt7b", &FreeMonoOblique9pt7b },
+  { "FreeSans12pt7b", &FreeSans12pt7b },
+  { "FreeSans18pt7b", &FreeSans18pt7b },
+  { "FreeSans24pt7b", &FreeSans24pt7b },
+  { "FreeSans9pt7b", &FreeSans9pt7b },
+  { "FreeSansBold12pt7b", &FreeSansBold12pt7b },
+  { "FreeSansBold18pt7b", &FreeSansBold18pt7b },
+  { "FreeSansBold24pt7b", &FreeSansBold24pt7b },
+  { "FreeSansBold9pt7b", &FreeSansBold9pt7b },
+  { "FreeSansBoldOblique12pt7b", &FreeSansBoldOblique12pt7b },
+  { "FreeSansBoldOblique18pt7b", &FreeSansBoldOblique18pt7b },
+  { "FreeSansBoldOblique24pt7b", &FreeSansBoldOblique24pt7b },
+  { "FreeSansBoldOblique9pt7b", &FreeSansBoldOblique9pt7b },
+  { "FreeSansOblique12pt7b", &FreeSansOblique12pt7b },
+  { "FreeSansOblique18pt7b", &FreeSansOblique18pt7b },
+  { "FreeSansOblique24pt7b", &FreeSansOblique24pt7b },
+  { "FreeSansOblique9pt7b", &FreeSansOblique9pt7b },
+  { "FreeSerif12pt7b", &FreeSerif12pt7b },
+  { "FreeSerif18pt7b", &FreeSerif18pt7b },
+  { "FreeSerif24pt7b", &FreeSerif24pt7b },
+  { "FreeSerif9pt7b", &FreeSerif9pt7b },
+  { "FreeSerifBold12pt7b", &FreeSerifBold12pt7b },
+  { "FreeSerifBold18pt7b", &FreeSerifBold18pt7b },
+  { "FreeSerifBold24pt7b", &FreeSerifBold24pt7b },
+  { "FreeSerifBold9pt7b", &FreeSerifBold9pt7b },
+  { "FreeSerifBoldItalic12pt7b", &FreeSerifBoldItalic12pt7b },
+  { "FreeSerifBoldItalic18pt7b", &FreeSerifBoldItalic18pt7b },
+  { "FreeSerifBoldItalic24pt7b", &FreeSerifBoldItalic24pt7b },
+  { "FreeSerifBoldItalic9pt7b", &FreeSerifBoldItalic9pt7b },
+  { "FreeSerifItalic12pt7b", &FreeSerifItalic12pt7b },
+  { "FreeSerifItalic18pt7b", &FreeSerifItalic18pt7b },
+  { "FreeSerifItalic24pt7b", &FreeSerifItalic24pt7b },
+  { "FreeSerifItalic9pt7b", &FreeSerifItalic9pt7b },
+  { "Org_01", &Org_01 },
+  { "Picopixel", &Picopixel },
+  { "Tiny3x3a2pt7b", &Tiny3x3a2pt7b },
+  { "TomThumb", &TomThumb },
+};
+
+static const char* const texts[] = {
+  "0123456789 -42.5 3.14159 12:34:56",
+  "The quick brown fox jumps over the lazy dog! (Mixed) TEXT, 100% [ok]",
+  "Text is the most common thing drawn on a small display, so its cost adds up: "
+  "labels, values, menus and whole paragraphs like this one, which wraps at the "
+  "edge of the screen and continues on the next line until it is done.\n"
+  "A second paragraph starts after an explicit newline."
+};
+
+// Counts the low-level calls and pixels that reach the target. Calls made by
+// another counted call (e.g. writePixel() calling drawPixel()) are not counted
+// again. Counting is off during the timed runs.
+template <class Base>
+class Counting : public Base {
+public:
+  template <typename... Args>
+  Counting(Args... args) : Base(args...) {}
+
+  void drawPixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) override {
+    count(1);
+    Base::drawPixel(x, y, color);
+    --depth;
+  }
+
+  void writePixel(gfx_coord_t x, gfx_coord_t y, uint16_t color) override {
+    count(1);
+    Base::writePixel(x, y, color);
+    --depth;
+  }
+
+  void writeFastHLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, uint16_t color) override {
+    count(w);
+    Base::writeFastHLine(x, y, w, color);
+    --depth;
+  }
+
+  void writeFastVLine(gfx_coord_t x, gfx_coord_t y, gfx_coord_t h, uint16_t color) override {
+    count(h);
+    Base::writeFastVLine(x, y, h, color);
+    --depth;
+  }
+
+  void writeFillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) override {
+    count(static_cast<int32_t>(w) * h);
+    Base::writeFillRect(x, y, w, h, color);
+    --depth;
+  }
+
+  void fillRect(gfx_coord_t x, gfx_coord_t y, gfx_coord_t w, gfx_coord_t h, uint16_t color) override {
+    count(static_cast<int32_t>(w) * h);
+    Base::fillRect(x, y, w, h, color);
+    --depth;
+  }
+
+  bool counting = false;
+  uint32_t spans = 0;
+  uint32_t pixels = 0;
+
+private:
+  void count(int32_t n) {
+    if (counting && !depth) {
+      spans++;
+      pixels += n > 0 ? n : 0;
+    }
+    depth++;
+  }
+
+  uint8_t depth = 0;
+};
+
+// Display without a panel: the address window protocol of an ILI9341
+class MockTFT : public Adafruit_SPITFT {
+public:
+  MockTFT(uint16_t w, uint16_t h, int8_t cs, int8_t dc) : Adafruit_SPITFT(w, h, cs, dc) {}
+
+  void begin(uint32_t freq) override { initSPI(freq); }
+
+  void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) const override {
+    writeCommand(0x2A); // CASET
+    SPI_WRITE32((static_cast<uint32_t>(x) << 16) | (x + w - 1));
+    writeCommand(0x2B); // PASET
+    SPI_WRITE32((static_cast<uint32_t>(y) << 16) | (y + h - 1));
+    writeCommand(0x2C); // RAMWR
+  }
+
+};
+
+Counting<GFXcanvas1> canvas1(WIDTH, HEIGHT);
+Counting<GFXcanvas16> canvas16(WIDTH, HEIGHT);
+Counting<MockTFT> tft(WIDTH, HEIGHT, TFT_CS, TFT_DC);
+
+// SPI bytes sent so far, false if not available for the target
+static bool spiBytes(Adafruit_GFX&, uint32_t&) { return false; }
+
+static bool spiBytes(MockTFT& tft, uint32_t& bytes) {
+#if ADAFRUIT_GFX_SPITFT_STATS
+  bytes = tft.traffic().bytes;
+  return true;
+#else
+  static_cast<void>(tft);
+  static_cast<void>(bytes);
+  return false;
+#endif
+}
+
+static uint32_t glyphs(const char* text) {
+  uint32_t n = 0;
+  for (; *text; text++) n += *text != '\n';
+  return n;
+}
+
+static void render(Adafruit_GFX& gfx, const GFXfont* font, uint8_t size) {
+  gfx.setFont(font);
+  gfx.setTextSize(size);
+  gfx.setTextWrap(true);
+  gfx.setTextColor(0xffff);
+  for (const char* text : texts) {
+    // GFXfonts are drawn above the cursor, the classic font below it
+    gfx.setCursor(0, font ? static_cast<gfx_coord_t>(pgm_read_byte(&font->yAdvance) * size) : 0);
+    gfx.print(text);
+  }
+}
+
+template <class Target>
+static void measure(Counting<Target>& gfx, const Font& font, uint8_t size) {
+  uint32_t n = 0;
+  for (const char* text : texts) n += glyphs(text);
+
+  // Counting pass, then the timed pass without counting
+  gfx.counting = true;
+  gfx.spans = gfx.pixels = 0;
+  uint32_t bytes_start = 0, bytes_end = 0;
+  spiBytes(gfx, bytes_start);
+  render(gfx, font.font, size);
+  const bool spi = spiBytes(gfx, bytes_end);
+  gfx.counting = false;
+
+  const uint32_t start = micros();
+  for (uint8_t i = 0; i < REPEATS; i++) render(gfx, font.font, size);
+  const uint32_t us = micros() - start;
+  const double seconds = (us ? us : 1) / 1e6;
+
+  Serial.print(font.name);
+  for (int16_t pad = 28 - strlen(font.name); pad > 0; pad--) Serial.print(' ');
+  Serial.print(size);
+  Serial.print(F("\t"));
+  Serial.print(static_cast<uint32_t>(n * REPEATS / seconds));
+  Serial.print(F("\t\t"));
+  Serial.print(static_cast<uint32_t>(gfx.pixels * static_cast<double>(REPEATS) / seconds));
+  Serial.print(F("\t\t"));
+  Serial.print(static_cast<double>(gfx.spans) / n, 2);
+  Serial.print(F("\t\t"));
+  if (spi) {
+    Serial.println(static_cast<double>(bytes_end - bytes_start) / n, 2);
+  } else {
+    Serial.println(F("n/a"));
+  }
+}
+
+template <class Target>
+static void run(const char* title, Counting<Target>& gfx) {
+  Serial.println();
+  Serial.println(title);
+  Serial.println(F("Font                        size  glyphs/s\tpixels/s\tspans/glyph\tSPI bytes/glyph"));
+  for (const Font& font : fonts) {
+    for (uint8_t size = 1; size <= 4; size++) {
+      gfx.fillScreen(0);
+      measure(gfx, font, size);
+    }
+  }
+}
+
+void setup() {
+  Serial.begin(115200);
+  tft.begin(0);
+
+  run("GFXcanvas1", canvas1);
+  run("GFXcanvas16", canvas16);
+  run("Mock SPI display", tft);
+
+#if ADAFRUIT_GFX_SPITFT_STATS
+  // 24 MHz clock, 1 us per transaction, 50 ns per pin toggle, 200 ns per driver call
+  const GFXbusModel bus(24'000'000, 1000, 50, 200);
+  tft.fillScreen(0);
+  tft.resetTraffic();
+  render(tft, &FreeSans9pt7b, 1);
+  Serial.println();
+  Serial.println(F("Predicted bus time of the strings in FreeSans9pt7b, size 1"));
+  bus.report(Serial, tft.traffic());
+#endif
+}
+
+void loop() {}
@@ -0,0 +1,450 @@
+/*
+Flash footprint analyzer for Adafruit_GFX fonts and bitmaps.
+
+NOT AN ARDUINO SKETCH.  This is a command-line tool that reads font
+headers made by fontconvert (e.g. the ones in ../Fonts) and headers with
+bitmap arrays, and reports what they cost in flash:
+
+  - per font: bitmap, glyph table and total bytes
+  - per glyph range: digits, upper case, lower case, other ASCII and
+    extended characters
+  - per glyph (with -g): size and bytes of every glyph
+  - estimated savings from subsetting a font to a set of characters,
+    from run-length encoding the glyph bitmaps and, for bitmap arrays,
+    from a 4-bit palette
+
+Usage:
+  ./assetsize [-g] [-s chars] file.h [file.h ...]
+e.g.
+  ./assetsize -s "0123456789.-" ../Fonts/FreeSans9pt7b.h ../Fonts/Org_01.h
+
+Sizes assume a 32-bit MCU (8-byte GFXglyph, 12-byte GFXfont).  Only simple
+conditionals (#if / #ifdef / #ifndef of macros defined in the same file)
+are evaluated.  The savings are estimates: RLE counts 4-bit run lengths
+per glyph, keeping a glyph raw when that is smaller, and ignores the
+decoder; the palette estimate ignores row padding.
+*/
+#ifndef ARDUINO
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+#include "../gfxfont.h" // Adafruit_GFX font structures
+
+#define GLYPH_BYTES 8  // sizeof(GFXglyph) on 32-bit MCUs
+#define FONT_BYTES  12 // sizeof(GFXfont) on 32-bit MCUs
+#define MAX_NAME    128
+#define MAX_ITEMS   256
+#define MAX_DEFINES 64
+
+typedef struct {
+	char  name[MAX_NAME];
+	int   elemSize; // 1 or 2 bytes, 0 for a GFXglyph table
+	long *values;
+	int   count;    // Number of values (6 per glyph for GFXglyph tables)
+	int   used;     // Referenced by a font
+} Array;
+
+typedef struct {
+	char name[MAX_NAME];
+	char bitmapName[MAX_NAME];
+	char glyphName[MAX_NAME];
+	int  first, last, yAdvance;
+} Font;
+
+typedef struct {
+	char name[MAX_NAME];
+	long value;
+} Define;
+
+static Array  arrays[MAX_ITEMS];
+static int    numArrays;
+static Font   fonts[MAX_ITEMS];
+static int    numFonts;
+static Define defines[MAX_DEFINES];
+static int    numDefines;
+
+// Token scanner over the preprocessed text of one file
+static const char *src;
+static char        token[MAX_NAME];
+static long        tokenValue;
+enum { T_END, T_IDENT, T_NUMBER, T_PUNCT };
+
+static int nextToken(void) {
+	while(*src && isspace((unsigned char)*src)) src++;
+	if(!*src) return T_END;
+	if(isalpha((unsigned char)*src) || (*src == '_')) {
+		int n = 0;
+		while(isalnum((unsigned char)*src) || (*src == '_')) {
+			if(n < MAX_NAME - 1) token[n++] = *src;
+			src++;
+		}
+		token[n] = 0;
+		return T_IDENT;
+	}
+	if(isdigit((unsigned char)*src)) {
+		char *end;
+		tokenValue = strtol(src, &end, 0);
+		src = end;
+		while(isalpha((unsigned char)*src)) src++; // Suffixes like 'u'
+		return T_NUMBER;
+	}
+	token[0] = *src++;
+	token[1] = 0;
+	return T_PUNCT;
+}
+
+static long lookupDefine(const char *name, int *found) {
+	int i;
+	for(i=0; i<numDefines; i++) {
+		if(!strcmp(defines[i].name, name)) {
+			*found = 1;
+			return defines[i].value;
+		}
+	}
+	*found = 0;
+	return 0;
+}
+
+// Strip comments and inactive conditional blocks, record #defines.
+// Returns a malloc'd buffer with the remaining code.
+static char *preprocess(const char *text) {
+	char *out = malloc(strlen(text) + 1), *o = out;
+	int   active[32] = { 1 }, depth = 0, found;
+	const char *p = text;
+
+	while(*p) {
+		const char *eol = strchr(p, '\n'), *q = p;
+		size_t      len;
+		if(!eol) eol = p + strlen(p);
+		len = eol - p;
+		while((q < eol) && isspace((unsigned char)*q)) q++;
+
+		if(*q == '#') {
+			char directive[16] = "", name[MAX_NAME] = "";
+			long value = 1;
+			sscanf(q + 1, " %15[a-z] ( %127[A-Za-z0-9_]", directive, name);
+			if(!name[0]) sscanf(q + 1, " %15[a-z] %127[A-Za-z0-9_] %ld", directive, name, &value);
+			if(!strcmp(directive, "define") && active[depth] && (numDefines < MAX_DEFINES)) {
+				sscanf(q + 1, " define %127[A-Za-z0-9_] %ld", name, &value);
+				strcpy(defines[numDefines].name, name);
+				defines[numDefines++].value = value;
+			} else if(!strncmp(directive, "if", 2) && (depth < 31)) {
+				value = lookupDefine(name, &found);
+				if(!strcmp(directive, "ifdef"))       value = found;
+				else if(!strcmp(directive, "ifndef")) value = !found;
+				else if(isdigit((unsigned char)name[0])) value = atol(name);
+				depth++;
+				active[depth] = active[depth - 1] && value;
+			} else if(!strcmp(directive, "else") && depth) {
+				active[depth] = active[depth - 1] && !active[depth];
+			} else if(!strcmp(directive, "endif") && depth) {
+				depth--;
+			}
+		} else if(active[depth]) {
+			memcpy(o, p, len);
+			o += len;
+			*o++ = '\n';
+		}
+		p = *eol ? eol + 1 : eol;
+	}
+	*o = 0;
+
+	// Remove comments in place
+	for(p=out, o=out; *p; ) {
+		if((p[0] == '/') && (p[1] == '/')) {
+			while(*p && (*p != '\n')) p++;
+		} else if((p[0] == '/') && (p[1] == '*')) {
+			p += 2;
+			while(*p && !((p[0] == '*') && (p[1] == '/'))) p++;
+			if(*p) p += 2;
+		} else {
+			*o++ = *p++;
+		}
+	}
+	*o = 0;
+	return out;
+}
+
+// Collect the numbers of an initializer list, src is after its '{'
+static void readValues(Array *a) {
+	int  level = 1, capacity = 256, type, negative = 0;
+	a->values = malloc(capacity * sizeof(long));
+	a->count  = 0;
+	while(level && ((type = nextToken()) != T_END)) {
+		if(type == T_NUMBER) {
+			if(a->count == capacity) {
+				capacity *= 2;
+				a->values = realloc(a->values, capacity * sizeof(long));
+			}
+			a->values[a->count++] = negative ? -tokenValue : tokenValue;
+		} else if(type == T_PUNCT) {
+			if(token[0] == '{') level++;
+			else if(token[0] == '}') level--;
+		}
+		negative = (type == T_PUNCT) && (token[0] == '-');
+	}
+}
+
+// Font initializer: bitmap name, glyph name, first, last, yAdvance
+static void readFont(Font *f) {
+	int type, level = 1, names = 0, numbers = 0;
+	long values[3] = { 0 };
+	while(level && ((type = nextToken()) != T_END)) {
+		if(type == T_PUNCT) {
+			if(token[0] == '{') level++;
+			else if(token[0] == '}') level--;
+		} else if(type == T_IDENT) {
+			if(!strcmp(token, "uint8_t") || !strcmp(token, "GFXglyph") || !strcmp(token, "const")) continue;
+			if(names == 0) strcpy(f->bitmapName, token);
+			else if(names == 1) strcpy(f->glyphName, token);
+			names++;
+		} else if((type == T_NUMBER) && (numbers < 3)) {
+			values[numbers++] = tokenValue;
+		}
+	}
+	f->first    = values[0];
+	f->last     = values[1];
+	f->yAdvance = values[2];
+}
+
+// Skip a brace block, src is after its '{'
+static void skipBlock(void) {
+	int type, level = 1;
+	while(level && ((type = nextToken()) != T_END)) {
+		if(type == T_PUNCT) {
+			if(token[0] == '{') level++;
+			else if(token[0] == '}') level--;
+		}
+	}
+}
+
+// Find 'type name[...] = { ... }' arrays and 'GFXfont name = { ... }'
+// fonts, skip everything else (functions, structs, ...)
+static void parse(const char *text) {
+	int  type, elemSize = -1, isFont = 0, isArray = 0, assign = 0;
+	char name[MAX_NAME] = "";
+
+	src = text;
+	while((type = nextToken()) != T_END) {
+		if(type == T_IDENT) {
+			if(!strcmp(token, "GFXglyph")) elemSize = 0;
+			else if(!strcmp(token, "GFXfont")) isFont = 1;
+			else if(!strcmp(token, "uint8_t") || !strcmp(token, "char") || !strcmp(token, "int8_t")) elemSize = 1;
+			else if(!strcmp(token, "uint16_t") || !strcmp(token, "int16_t")) elemSize = 2;
+			else if(strcmp(token, "const") && strcmp(token, "constexpr") && strcmp(token, "static") && strcmp(token, "unsigned") &&
+			  strcmp(token, "PROGMEM") && !name[0]) strcpy(name, token);
+		} else if(type == T_PUNCT) {
+			if((token[0] == '[') && name[0]) {
+				isArray = 1;
+			} else if(token[0] == '=') {
+				assign = 1;
+			} else if(token[0] == '{') {
+				if(assign && name[0] && isFont && (numFonts < MAX_ITEMS)) {
+					memset(&fonts[numFonts], 0, sizeof(Font));
+					strcpy(fonts[numFonts].name, name);
+					readFont(&fonts[numFonts++]);
+				} else if(assign && name[0] && isArray && (elemSize >= 0) && (numArrays < MAX_ITEMS)) {
+					memset(&arrays[numArrays], 0, sizeof(Array));
+					strcpy(arrays[numArrays].name, name);
+					arrays[numArrays].elemSize = elemSize;
+					readValues(&arrays[numArrays++]);
+				} else {
+					skipBlock();
+				}
+			}
+			if((token[0] == '{') || (token[0] == ';')) {
+				elemSize = -1;
+				isFont   = isArray = assign = 0;
+				name[0]  = 0;
+			}
+		}
+	}
+}
+
+static Array *findArray(const char *name) {
+	int i;
+	for(i=0; i<numArrays; i++) {
+		if(!strcmp(arrays[i].name, name)) return &arrays[i];
+	}
+	return NULL;
+}
+
+// Bytes of 'bits' bits at a bitmap position as 4-bit run lengths of
+// alternating colors, starting with 0.  Runs longer than 15 are split
+// with an empty run of the other color.
+static int rleBytes(const long *bytes, int count, long offset, long bits) {
+	int  nibbles = 0, run = 0, color = 0;
+	long i;
+	for(i=0; i<bits; i++) {
+		long byte = offset + i / 8;
+		int  bit  = (byte < count) ? ((bytes[byte] >> (7 - (i & 7))) & 1) : 0;
+		if(bit != color) {
+			nibbles++;
+			run   = 0;
+			color = bit;
+		}
+		if(++run > 15) {
+			nibbles += 2; // Full run plus an empty one of the other color
+			run = 1;
+		}
+	}
+	return (nibbles + 2) / 2; // The last run, rounded up to bytes
+}
+
+static const char *rangeNames[] = { "digits", "upper case", "lower case", "other ASCII", "extended" };
+
+static int rangeOf(int c) {
+	if((c >= '0') && (c <= '9')) return 0;
+	if((c >= 'A') && (c <= 'Z')) return 1;
+	if((c >= 'a') && (c <= 'z')) return 2;
+	if(c < 0x7F) return 3;
+	return 4;
+}
+
+// Returns the font's total bytes
+static long reportFont(const Font *f, int perGlyph, const char *subset) {
+	Array *bitmap = findArray(f->bitmapName), *glyphs = findArray(f->glyphName);
+	long   bitmapBytes, total, rle = 0, subsetBitmap = 0;
+	long   rangeBytes[5] = { 0 };
+	int    rangeGlyphs[5] = { 0 }, count, i, subsetFirst = 256, subsetLast = -1;
+
+	if(!bitmap || !glyphs) {
+		printf("%s: bitmap or glyph array not found\n\n", f->name);
+		return 0;
+	}
+	bitmap->used = glyphs->used = 1;
+	count = glyphs->count / 6;
+	if(count > f->last - f->first + 1) count = f->last - f->first + 1;
+	bitmapBytes = bitmap->count;
+	total       = bitmapBytes + (long)count * GLYPH_BYTES + FONT_BYTES;
+
+	printf("%s: %ld bytes, %d glyphs 0x%02X-0x%02X, yAdvance %d\n",
+	  f->name, total, count, f->first, f->last, f->yAdvance);
+	printf("  bitmaps %ld, glyph table %ld, font %d\n",
+	  bitmapBytes, (long)count * GLYPH_BYTES, FONT_BYTES);
+	if(perGlyph) printf("  glyph       size  bytes  rle\n");
+
+	for(i=0; i<count; i++) {
+		const long *g = &glyphs->values[i * 6];
+		int   c       = f->first + i;
+		long  bits    = g[1] * g[2], raw = (bits + 7) / 8;
+		int   r       = rleBytes(bitmap->values, bitmap->count, g[0], bits);
+		if(r > raw) r = raw;
+		rle += r;
+		rangeGlyphs[rangeOf(c)]++;
+		rangeBytes[rangeOf(c)] += raw + GLYPH_BYTES;
+		if(subset && strchr(subset, c) && c) {
+			subsetBitmap += raw;
+			if(c < subsetFirst) subsetFirst = c;
+			if(c > subsetLast)  subsetLast  = c;
+		}
+		if(perGlyph) {
+			printf("  0x%02X", c);
+			if((c >= ' ') && (c <= '~')) printf(" '%c'", c);
+			else                         printf("    ");
+			printf("  %3ldx%-3ld %5ld  %4d\n", g[1], g[2], raw, r);
+		}
+	}
+
+	for(i=0; i<5; i++) {
+		if(rangeGlyphs[i]) {
+			printf("  %-12s %3d glyphs %6ld bytes\n", rangeNames[i], rangeGlyphs[i], rangeBytes[i]);
+		}
+	}
+
+	printf("  RLE bitmaps: %ld bytes, saves %ld\n", rle, bitmapBytes - rle);
+	if(subset) {
+		long s = FONT_BYTES;
+		if(subsetLast >= 0) s += subsetBitmap + (long)(subsetLast - subsetFirst + 1) * GLYPH_BYTES;
+		printf("  subset \"%s\": %ld bytes, saves %ld\n", subset, s, total - s);
+	}
+	printf("  4-bit palette: n/a, glyphs are 1 bit per pixel\n\n");
+	return total;
+}
+
+// Arrays not used by a font, e.g. drawBitmap(), drawGrayscaleBitmap() or
+// drawRGBBitmap() images
+static long reportBitmap(const Array *a) {
+	long bytes = (long)a->count * a->elemSize;
+	int  distinct = 0, i, j;
+
+	// Distinct pixel values, up to 17 is enough for the palette estimate
+	long colors[17];
+	for(i=0; (i<a->count) && (distinct <= 16); i++) {
+		for(j=0; (j<distinct) && (colors[j] != a->values[i]); j++);
+		if(j == distinct) colors[distinct++] = a->values[i];
+	}
+
+	printf("%s: %ld bytes, %d x %d-bit values\n", a->name, bytes, a->count, a->elemSize * 8);
+	if(a->elemSize == 1) {
+		long r = rleBytes(a->values, a->count, 0, (long)a->count * 8);
+		printf("  as 1-bit bitmap, RLE: %ld bytes, saves %ld\n", r, bytes - r);
+	}
+	if(distinct <= 16) {
+		long p = (a->count + 1) / 2 + distinct * a->elemSize;
+		printf("  %d values, 4-bit palette: %ld bytes, saves %ld\n\n", distinct, p, bytes - p);
+	} else {
+		printf("  more than 16 values, 4-bit palette: n/a\n\n");
+	}
+	return bytes;
+}
+
+int main(int argc, char *argv[]) {
+	int         i, perGlyph = 0, bitmaps = 0;
+	const char *subset = NULL;
+	long        total = 0;
+
+	// Parse command line.  Valid syntax is:
+	//   assetsize [-g] [-s chars] file.h [file.h ...]
+	for(i=1; (i<argc) && (argv[i][0] == '-'); i++) {
+		if(!strcmp(argv[i], "-g")) {
+			perGlyph = 1;
+		} else if(!strcmp(argv[i], "-s") && (i + 1 < argc)) {
+			subset = argv[++i];
+		} else {
+			break;
+		}
+	}
+	if(i == argc) {
+		fprintf(stderr, "Usage: %s [-g] [-s chars] file.h [file.h ...]\n", argv[0]);
+		return 1;
+	}
+
+	for(; i<argc; i++) {
+		FILE *file = fopen(argv[i], "rb");
+		char *text, *code;
+		long  size;
+		if(!file) {
+			fprintf(stderr, "Can't open %s\n", argv[i]);
+			return 1;
+		}
+		fseek(file, 0, SEEK_END);
+		size = ftell(file);
+		fseek(file, 0, SEEK_SET);
+		text = malloc(size + 1);
+		text[fread(text, 1, size, file)] = 0;
+		fclose(file);
+
+		numDefines = 0;
+		code = preprocess(text);
+		parse(code);
+		free(code);
+		free(text);
+	}
+
+	for(i=0; i<numFonts; i++) total += reportFont(&fonts[i], perGlyph, subset);
+	for(i=0; i<numArrays; i++) {
+		if(!arrays[i].used && arrays[i].elemSize) {
+			total += reportBitmap(&arrays[i]);
+			bitmaps++;
+		}
+	}
+	printf("Total: %ld bytes in %d fonts and %d bitmaps\n", total, numFonts, bitmaps);
+
+	return 0;
+}
+
+#endif /* !ARDUINO */
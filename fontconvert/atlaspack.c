@@ -0,0 +1,266 @@
+/*
+Icon atlas packer for Adafruit_GFX.
+
+NOT AN ARDUINO SKETCH.  This is a command-line tool that packs icons into
+one atlas bitmap for drawIcon(): identical icons are stored once, the rest
+are packed onto shelves (sorted by height, filled left to right), and an
+icon table maps every input file to its rectangle.  One large asset instead
+of many small ones also keeps flash reads close together, which helps the
+flash cache of XIP MCUs.
+
+Icons are read from netpbm files: PPM (P3/P6) become an RGB 5/6/5 atlas,
+PBM (P1/P4) a 1-bit atlas with set (black) pixels drawn in the given
+color.  All icons of an atlas must have the same kind; most image editors
+and ImageMagick ('convert icon.png icon.ppm') write these formats.
+
+Usage:
+  ./atlaspack [-w width] name icon.ppm [icon.ppm ...] > name.h
+e.g.
+  ./atlaspack Icons wifi.ppm wifi_off.ppm battery.ppm > Icons.h
+
+Outputs to stdout: the atlas bitmap, the icon table, the GFXatlas struct
+and one #define per icon with its id, named <name>_<FILE NAME>.
+Icons are at most 255 x 255 pixels.
+*/
+#ifndef ARDUINO
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+#include <math.h>
+#include "../gfxatlas.h" // Adafruit_GFX atlas structures
+
+typedef struct {
+	char      name[128];
+	int       width, height, depth;
+	uint16_t *pixels;  // RGB 5/6/5, or 0/1 for 1-bit icons
+	int       same;    // Index of the first identical icon, or own index
+	int       x, y;    // Position in the atlas
+} Icon;
+
+// Next header number of a netpbm file, skips whitespace and comments
+static int readNumber(FILE *f) {
+	int c, n = 0;
+	while((c = fgetc(f)) != EOF) {
+		if(c == '#') {
+			while(((c = fgetc(f)) != EOF) && (c != '\n'));
+		} else if(!isspace(c)) {
+			break;
+		}
+	}
+	if(!isdigit(c)) return -1;
+	while(isdigit(c)) {
+		n = n * 10 + (c - '0');
+		c = fgetc(f);
+	}
+	return n; // One whitespace after the number is consumed
+}
+
+static int readSample(FILE *f, int ascii, int maxval) {
+	int v;
+	if(ascii) return readNumber(f);
+	v = fgetc(f);
+	if(maxval > 255) v = (v << 8) | fgetc(f);
+	return v;
+}
+
+static int load(Icon *icon, const char *path) {
+	FILE *f = fopen(path, "rb");
+	int   type, maxval = 1, x, y;
+	const char *base;
+	char *dot;
+
+	if(!f) {
+		fprintf(stderr, "Can't open %s\n", path);
+		return 0;
+	}
+	if((fgetc(f) != 'P') || ((type = fgetc(f) - '0'), (type != 1) && (type != 3) && (type != 4) && (type != 6))) {
+		fprintf(stderr, "%s: not a PBM or PPM file\n", path);
+		fclose(f);
+		return 0;
+	}
+	icon->width  = readNumber(f);
+	icon->height = readNumber(f);
+	if((type == 3) || (type == 6)) maxval = readNumber(f);
+	if((icon->width <= 0) || (icon->height <= 0) || (icon->width > 255) || (icon->height > 255) || (maxval <= 0)) {
+		fprintf(stderr, "%s: size must be 1 to 255 pixels\n", path);
+		fclose(f);
+		return 0;
+	}
+	icon->depth  = ((type == 1) || (type == 4)) ? 1 : 16;
+	icon->pixels = malloc(icon->width * icon->height * sizeof(uint16_t));
+
+	for(y=0; y<icon->height; y++) {
+		int bits = 0, byte = 0;
+		for(x=0; x<icon->width; x++) {
+			uint16_t *p = &icon->pixels[y * icon->width + x];
+			if(type == 1) {
+				int c;
+				while(((c = fgetc(f)) != EOF) && isspace(c));
+				*p = (c == '1');
+			} else if(type == 4) {
+				if(!bits) {
+					byte = fgetc(f);
+					bits = 8;
+				}
+				*p = (byte >> --bits) & 1;
+			} else {
+				long r = readSample(f, type == 3, maxval) * 255L / maxval;
+				long g = readSample(f, type == 3, maxval) * 255L / maxval;
+				long b = readSample(f, type == 3, maxval) * 255L / maxval;
+				*p = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+			}
+		}
+	}
+	fclose(f);
+
+	// Icon name from the file name, without path and extension
+	base = strrchr(path, '/');
+	base = base ? base + 1 : path;
+	strncpy(icon->name, base, sizeof(icon->name) - 1);
+	if((dot = strrchr(icon->name, '.'))) *dot = 0;
+	for(x=0; icon->name[x]; x++) {
+		icon->name[x] = isalnum((unsigned char)icon->name[x]) ? toupper((unsigned char)icon->name[x]) : '_';
+	}
+	return 1;
+}
+
+static Icon *icons;
+static int   numIcons;
+
+// Unique icons by decreasing height, then width
+static int compareHeight(const void *a, const void *b) {
+	const Icon *ia = &icons[*(const int *)a], *ib = &icons[*(const int *)b];
+	if(ia->height != ib->height) return ib->height - ia->height;
+	return ib->width - ia->width;
+}
+
+int main(int argc, char *argv[]) {
+	int   i, j, width = 0, height = 0, numUnique = 0, maxWidth = 0, depth, arg = 1;
+	int  *order;
+	long  area = 0, bytes;
+	const char *name;
+	uint16_t   *atlas;
+
+	// Parse command line.  Valid syntax is:
+	//   atlaspack [-w width] name icon [icon ...]
+	if((argc > 2) && !strcmp(argv[1], "-w")) {
+		width = atoi(argv[2]);
+		arg   = 3;
+	}
+	if(argc - arg < 2) {
+		fprintf(stderr, "Usage: %s [-w width] name icon.ppm [icon.ppm ...]\n", argv[0]);
+		return 1;
+	}
+	name     = argv[arg++];
+	numIcons = argc - arg;
+	icons    = calloc(numIcons, sizeof(Icon));
+	order    = malloc(numIcons * sizeof(int));
+
+	for(i=0; i<numIcons; i++) {
+		if(!load(&icons[i], argv[arg + i])) return 1;
+		if(icons[i].depth != icons[0].depth) {
+			fprintf(stderr, "%s: all icons must be PPM or all PBM\n", argv[arg + i]);
+			return 1;
+		}
+	}
+	depth = icons[0].depth;
+
+	// Deduplicate identical icons
+	for(i=0; i<numIcons; i++) {
+		icons[i].same = i;
+		for(j=0; j<i; j++) {
+			if((icons[j].same == j) && (icons[j].width == icons[i].width) && (icons[j].height == icons[i].height) &&
+			  !memcmp(icons[j].pixels, icons[i].pixels, icons[i].width * icons[i].height * sizeof(uint16_t))) {
+				icons[i].same = j;
+				break;
+			}
+		}
+		if(icons[i].same == i) {
+			order[numUnique++] = i;
+			area += icons[i].width * icons[i].height;
+			if(icons[i].width > maxWidth) maxWidth = icons[i].width;
+		}
+	}
+
+	// Shelf packing: a square-ish atlas unless the width is given
+	if(width <= 0) width = (int)ceil(sqrt(area * 1.1));
+	if(width < maxWidth) width = maxWidth;
+	if(depth == 1) width = (width + 7) & ~7; // No padding bits at row ends
+	qsort(order, numUnique, sizeof(int), compareHeight);
+	{
+		int x = 0, y = 0, shelf = 0;
+		for(i=0; i<numUnique; i++) {
+			Icon *icon = &icons[order[i]];
+			if(x + icon->width > width) {
+				x     = 0;
+				y    += shelf;
+				shelf = 0;
+			}
+			icon->x = x;
+			icon->y = y;
+			x += icon->width;
+			if(icon->height > shelf) shelf = icon->height;
+		}
+		height = y + shelf;
+	}
+	if((width > 65535) || (height > 65535)) {
+		fprintf(stderr, "Atlas too large: %d x %d\n", width, height);
+		return 1;
+	}
+
+	atlas = calloc((size_t)width * height, sizeof(uint16_t));
+	for(i=0; i<numUnique; i++) {
+		const Icon *icon = &icons[order[i]];
+		for(j=0; j<icon->height; j++) {
+			memcpy(&atlas[(size_t)(icon->y + j) * width + icon->x], &icon->pixels[j * icon->width],
+			  icon->width * sizeof(uint16_t));
+		}
+	}
+	for(i=0; i<numIcons; i++) {
+		icons[i].x = icons[icons[i].same].x;
+		icons[i].y = icons[icons[i].same].y;
+	}
+
+	// Atlas bitmap
+	bytes = (depth == 16) ? (long)width * height * 2 : (long)(width / 8) * height;
+	printf("// %d icons, %d unique, packed into %d x %d pixels\n\n", numIcons, numUnique, width, height);
+	if(depth == 16) {
+		printf("const uint16_t %sBitmap[] PROGMEM = {", name);
+		for(i=0; i<width * height; i++) {
+			printf("%s0x%04X", (i % 12) ? ", " : (i ? ",\n  " : "\n  "), atlas[i]);
+		}
+	} else {
+		printf("const uint8_t %sBitmap[] PROGMEM = {", name);
+		for(i=0; i<width * height / 8; i++) {
+			int byte = 0;
+			for(j=0; j<8; j++) byte = (byte << 1) | atlas[i * 8 + j];
+			printf("%s0x%02X", (i % 12) ? ", " : (i ? ",\n  " : "\n  "), byte);
+		}
+	}
+	printf(" };\n\n");
+
+	// Icon table
+	printf("const GFXatlasIcon %sIcons[] PROGMEM = {\n", name);
+	for(i=0; i<numIcons; i++) {
+		printf("  { %5d, %5d, %3d, %3d }%s // %d %s%s\n", icons[i].x, icons[i].y, icons[i].width, icons[i].height,
+		  (i < numIcons - 1) ? "," : " ", i, icons[i].name, (icons[i].same != i) ? " (duplicate)" : "");
+	}
+	printf("};\n\n");
+
+	// Atlas and icon ids
+	printf("const GFXatlas %s PROGMEM = {\n", name);
+	printf("  (const uint8_t *)%sBitmap,\n", name);
+	printf("  %sIcons,\n", name);
+	printf("  %d, %d, %d, %d };\n\n", width, height, numIcons, depth);
+	for(i=0; i<numIcons; i++) {
+		printf("#define %s_%s %d\n", name, icons[i].name, i);
+	}
+	printf("\n// Approx. %ld bytes\n", bytes + numIcons * (long)sizeof(GFXatlasIcon) + 16);
+
+	return 0;
+}
+
+#endif /* !ARDUINO */
@@ -143,7 +143,7 @@ int main(int argc, char *argv[]) {
 	// the right symbols, and that's not done yet.
 	// fprintf(stderr, "%ld glyphs\n", face->num_glyphs);
 
-	printf("const uint8_t %sBitmaps[] PROGMEM = {\n  ", fontName);
+	printf("constexpr uint8_t %sBitmaps[] PROGMEM = {\n  ", fontName);
 
 	// Process glyphs and output huge bitmap data array
 	for(i=first, j=0; i<=last; i++, j++) {
@@ -209,7 +209,7 @@ int main(int argc, char *argv[]) {
 	printf(" };\n\n"); // End bitmap array
 
 	// Output glyph attributes table (one per character)
-	printf("const GFXglyph %sGlyphs[] PROGMEM = {\n", fontName);
+	printf("constexpr GFXglyph %sGlyphs[] PROGMEM = {\n", fontName);
 	for(i=first, j=0; i<=last; i++, j++) {
 		printf("  { %5d, %3d, %3d, %3d, %4d, %4d }",
 		  table[j].bitmapOffset,
@@ -231,7 +231,7 @@ int main(int argc, char *argv[]) {
 	printf("\n\n");
 
 	// Output font structure
-	printf("const GFXfont %s PROGMEM = {\n", fontName);
+	printf("constexpr GFXfont %s PROGMEM = {\n", fontName);
 	printf("  (uint8_t  *)%sBitmaps,\n", fontName);
 	printf("  (GFXglyph *)%sGlyphs,\n", fontName);
 	if (face->size->metrics.height == 0) {
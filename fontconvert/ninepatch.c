@@ -0,0 +1,148 @@
+/*
+Nine-patch converter for Adafruit_GFX.
+
+NOT AN ARDUINO SKETCH.  This is a command-line tool that turns an image
+with guide lines into a GFXninePatch for drawNinePatch().  As with Android
+.9.png files the image has a one pixel frame around the actual bitmap:
+black pixels in the top row mark the stretchable columns, black pixels in
+the left column the stretchable rows.  Both must be one contiguous run; the
+right and bottom frame lines are ignored.  The corners outside the marked
+columns and rows are drawn once, the rest repeats the stretchable region,
+so one small asset serves buttons, panels and dialog frames of any size.
+
+The image is read from a PPM file (P3/P6); most image editors and
+ImageMagick ('convert button.9.png button.ppm') write this format.
+
+Usage:
+  ./ninepatch name image.ppm > name.h
+e.g.
+  ./ninepatch Button button.ppm > Button.h
+
+Outputs to stdout: the RGB 5/6/5 bitmap without the frame and the
+GFXninePatch struct.
+*/
+#ifndef ARDUINO
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <stdint.h>
+#include "../gfxninepatch.h" // Adafruit_GFX nine-patch structure
+
+// Next header number of a netpbm file, skips whitespace and comments
+static int readNumber(FILE *f) {
+	int c, n = 0;
+	while((c = fgetc(f)) != EOF) {
+		if(c == '#') {
+			while(((c = fgetc(f)) != EOF) && (c != '\n'));
+		} else if(!isspace(c)) {
+			break;
+		}
+	}
+	if(!isdigit(c)) return -1;
+	while(isdigit(c)) {
+		n = n * 10 + (c - '0');
+		c = fgetc(f);
+	}
+	return n; // One whitespace after the number is consumed
+}
+
+static int readSample(FILE *f, int ascii, int maxval) {
+	int v;
+	if(ascii) return readNumber(f);
+	v = fgetc(f);
+	if(maxval > 255) v = (v << 8) | fgetc(f);
+	return v;
+}
+
+// First and last marked pixel of a guide line, returns 0 if unmarked or not contiguous
+static int guide(const uint8_t *marks, int count, int *first, int *last, const char *what) {
+	int i;
+	*first = -1;
+	for(i=0; i<count; i++) {
+		if(marks[i]) {
+			if(*first < 0) {
+				*first = i;
+			} else if(!marks[i - 1]) {
+				fprintf(stderr, "Stretchable %s are not contiguous\n", what);
+				return 0;
+			}
+			*last = i;
+		}
+	}
+	if(*first < 0) {
+		fprintf(stderr, "No stretchable %s marked\n", what);
+		return 0;
+	}
+	return 1;
+}
+
+int main(int argc, char *argv[]) {
+	int       type, width, height, maxval, x, y, x0, x1, y0, y1;
+	uint8_t  *columns, *rows;
+	uint16_t *bitmap;
+	const char *name;
+	FILE     *f;
+
+	// Parse command line.  Valid syntax is:
+	//   ninepatch name image.ppm
+	if(argc != 3) {
+		fprintf(stderr, "Usage: %s name image.ppm\n", argv[0]);
+		return 1;
+	}
+	name = argv[1];
+
+	if(!(f = fopen(argv[2], "rb"))) {
+		fprintf(stderr, "Can't open %s\n", argv[2]);
+		return 1;
+	}
+	if((fgetc(f) != 'P') || ((type = fgetc(f) - '0'), (type != 3) && (type != 6))) {
+		fprintf(stderr, "%s: not a PPM file\n", argv[2]);
+		return 1;
+	}
+	width  = readNumber(f);
+	height = readNumber(f);
+	maxval = readNumber(f);
+	if((width < 3) || (height < 3) || (width > 65537) || (height > 65537) || (maxval <= 0)) {
+		fprintf(stderr, "%s: size must be 3 to 65537 pixels, including the guide frame\n", argv[2]);
+		return 1;
+	}
+
+	columns = calloc(width, 1);
+	rows    = calloc(height, 1);
+	bitmap  = malloc((size_t)(width - 2) * (height - 2) * sizeof(uint16_t));
+	for(y=0; y<height; y++) {
+		for(x=0; x<width; x++) {
+			long r = readSample(f, type == 3, maxval) * 255L / maxval;
+			long g = readSample(f, type == 3, maxval) * 255L / maxval;
+			long b = readSample(f, type == 3, maxval) * 255L / maxval;
+			if((x == 0) || (y == 0) || (x == width - 1) || (y == height - 1)) {
+				// Guide frame: black pixels mark, anything else (usually white or transparent) doesn't
+				if((y == 0) && (x > 0) && (x < width - 1)) columns[x - 1] = !(r | g | b);
+				if((x == 0) && (y > 0) && (y < height - 1)) rows[y - 1] = !(r | g | b);
+			} else {
+				bitmap[(size_t)(y - 1) * (width - 2) + x - 1] = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+			}
+		}
+	}
+	fclose(f);
+	width  -= 2;
+	height -= 2;
+	if(!guide(columns, width, &x0, &x1, "columns") || !guide(rows, height, &y0, &y1, "rows")) return 1;
+
+	printf("// %d x %d pixels, stretchable columns %d-%d, rows %d-%d\n\n", width, height, x0, x1, y0, y1);
+	printf("const uint16_t %sBitmap[] PROGMEM = {", name);
+	for(x=0; x<width * height; x++) {
+		printf("%s0x%04X", (x % 12) ? ", " : (x ? ",\n  " : "\n  "), bitmap[x]);
+	}
+	printf(" };\n\n");
+
+	printf("const GFXninePatch %s PROGMEM = {\n", name);
+	printf("  %sBitmap,\n", name);
+	printf("  %d, %d, %d, %d, %d, %d };\n\n", width, height, x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+	printf("// Approx. %ld bytes\n", (long)width * height * 2 + (long)sizeof(GFXninePatch));
+
+	return 0;
+}
+
+#endif /* !ARDUINO */
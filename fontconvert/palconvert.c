@@ -0,0 +1,168 @@
+/*
+Indexed-color bitmap converter for Adafruit_GFX.
+
+NOT AN ARDUINO SKETCH.  This is a command-line tool that turns an image
+into a bitmap of palette indexes for drawIndexedBitmap().  The colors are
+reduced to RGB 5/6/5, every distinct color gets a palette entry, and the
+pixels are packed with 1, 2, 4 or 8 bits: the smallest depth that holds the
+palette unless -d is given.  A 4 bpp icon needs a quarter of the flash of
+its RGB 5/6/5 version.  No color quantization is done, reduce images with
+more than 256 colors first (e.g. 'convert icon.png -colors 16 icon.ppm').
+
+The image is read from a PPM file (P3/P6); most image editors and
+ImageMagick ('convert icon.png icon.ppm') write this format.
+
+Usage:
+  ./palconvert [-d depth] [-t RRGGBB] name image.ppm > name.h
+e.g.
+  ./palconvert -t FF00FF Logo logo.ppm > Logo.h
+
+-t names the color (24-bit hex, as in the image) of the pixels not to draw.
+
+Outputs to stdout: the index bitmap, the palette and the GFXindexedBitmap
+struct.
+*/
+#ifndef ARDUINO
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+#include "../gfxindexed.h" // Adafruit_GFX indexed bitmap structure
+
+// Next header number of a netpbm file, skips whitespace and comments
+static int readNumber(FILE *f) {
+	int c, n = 0;
+	while((c = fgetc(f)) != EOF) {
+		if(c == '#') {
+			while(((c = fgetc(f)) != EOF) && (c != '\n'));
+		} else if(!isspace(c)) {
+			break;
+		}
+	}
+	if(!isdigit(c)) return -1;
+	while(isdigit(c)) {
+		n = n * 10 + (c - '0');
+		c = fgetc(f);
+	}
+	return n; // One whitespace after the number is consumed
+}
+
+static int readSample(FILE *f, int ascii, int maxval) {
+	int v;
+	if(ascii) return readNumber(f);
+	v = fgetc(f);
+	if(maxval > 255) v = (v << 8) | fgetc(f);
+	return v;
+}
+
+int main(int argc, char *argv[]) {
+	int       type, width, height, maxval, i, x, y, depth = 0, arg = 1, numColors = 0, transparent = -1;
+	long      key = -1, stride;
+	uint16_t  palette[256];
+	uint8_t  *indexes;
+	const char *name;
+	FILE     *f;
+
+	// Parse command line.  Valid syntax is:
+	//   palconvert [-d depth] [-t RRGGBB] name image.ppm
+	while((arg < argc - 1) && (argv[arg][0] == '-')) {
+		if(!strcmp(argv[arg], "-d")) {
+			depth = atoi(argv[arg + 1]);
+		} else if(!strcmp(argv[arg], "-t")) {
+			key = strtol(argv[arg + 1], NULL, 16);
+		} else {
+			break;
+		}
+		arg += 2;
+	}
+	if((argc - arg != 2) || (depth && (depth != 1) && (depth != 2) && (depth != 4) && (depth != 8))) {
+		fprintf(stderr, "Usage: %s [-d 1|2|4|8] [-t RRGGBB] name image.ppm\n", argv[0]);
+		return 1;
+	}
+	name = argv[arg];
+
+	if(!(f = fopen(argv[arg + 1], "rb"))) {
+		fprintf(stderr, "Can't open %s\n", argv[arg + 1]);
+		return 1;
+	}
+	if((fgetc(f) != 'P') || ((type = fgetc(f) - '0'), (type != 3) && (type != 6))) {
+		fprintf(stderr, "%s: not a PPM file\n", argv[arg + 1]);
+		return 1;
+	}
+	width  = readNumber(f);
+	height = readNumber(f);
+	maxval = readNumber(f);
+	if((width <= 0) || (height <= 0) || (width > 65535) || (height > 65535) || (maxval <= 0)) {
+		fprintf(stderr, "%s: size must be 1 to 65535 pixels\n", argv[arg + 1]);
+		return 1;
+	}
+
+	// Palette in order of first use, the transparent color gets its own entry
+	indexes = malloc((size_t)width * height);
+	for(i=0; i<width * height; i++) {
+		long     r = readSample(f, type == 3, maxval) * 255L / maxval;
+		long     g = readSample(f, type == 3, maxval) * 255L / maxval;
+		long     b = readSample(f, type == 3, maxval) * 255L / maxval;
+		uint16_t c = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+		int      clear = (((r << 16) | (g << 8) | b) == key), j;
+		if(clear && (transparent >= 0)) {
+			indexes[i] = transparent;
+			continue;
+		}
+		for(j=0; j<numColors; j++) {
+			if((palette[j] == c) && (j != transparent)) break;
+		}
+		if(clear || (j == numColors)) {
+			if(numColors == 256) {
+				fprintf(stderr, "%s: more than 256 colors, reduce them first\n", argv[arg + 1]);
+				return 1;
+			}
+			j = numColors++;
+			palette[j] = c;
+			if(clear) transparent = j;
+		}
+		indexes[i] = j;
+	}
+	fclose(f);
+
+	if(!depth) {
+		for(depth=1; (1 << depth) < numColors; depth *= 2);
+	} else if((1 << depth) < numColors) {
+		fprintf(stderr, "%d colors don't fit into %d bits per pixel\n", numColors, depth);
+		return 1;
+	}
+
+	// Index bitmap, rows padded to whole bytes
+	stride = ((long)width * depth + 7) / 8;
+	printf("// %d x %d pixels, %d colors, %d bits per pixel\n\n", width, height, numColors, depth);
+	printf("const uint8_t %sBitmap[] PROGMEM = {", name);
+	for(y=0, i=0; y<height; y++) {
+		for(x=0; x<stride; x++, i++) {
+			int byte = 0, bit;
+			for(bit=0; bit<8; bit+=depth) {
+				int px = x * 8 / depth + bit / depth;
+				byte = (byte << depth) | ((px < width) ? indexes[(size_t)y * width + px] : 0);
+			}
+			printf("%s0x%02X", (i % 12) ? ", " : (i ? ",\n  " : "\n  "), byte);
+		}
+	}
+	printf(" };\n\n");
+
+	printf("const uint16_t %sPalette[] PROGMEM = {", name);
+	for(i=0; i<numColors; i++) {
+		printf("%s0x%04X", (i % 12) ? ", " : (i ? ",\n  " : "\n  "), palette[i]);
+	}
+	printf(" };\n\n");
+
+	printf("const GFXindexedBitmap %s PROGMEM = {\n", name);
+	printf("  %sBitmap,\n", name);
+	printf("  %sPalette,\n", name);
+	printf("  %d, %d, %d, %d };\n\n", width, height, depth, transparent);
+	printf("// Approx. %ld bytes\n", stride * height + numColors * 2L + (long)sizeof(GFXindexedBitmap));
+
+	return 0;
+}
+
+#endif /* !ARDUINO */
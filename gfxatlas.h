@@ -0,0 +1,25 @@
+// Icon atlas structures for Adafruit_GFX.
+// Icons are packed into one bitmap by fontconvert/atlaspack, which also
+// emits the icon table and the GFXatlas. Pass the address of the GFXatlas
+// struct and an icon id to drawIcon().
+
+#pragma once
+
+
+/// Position of an icon in the atlas bitmap
+typedef struct {
+    uint16_t x; ///< Left edge in the atlas, in pixels
+    uint16_t y; ///< Top edge in the atlas, in pixels
+    uint8_t width; ///< Icon width in pixels
+    uint8_t height; ///< Icon height in pixels
+} GFXatlasIcon;
+
+/// Icons packed into ONE BITMAP, identical icons share their pixels
+typedef struct {
+    const uint8_t* bitmap; ///< Atlas pixels: RGB 5/6/5 words if depth is 16, rows of bits padded to whole bytes if depth is 1
+    const GFXatlasIcon* icons; ///< Icon table, indexed by icon id
+    uint16_t width; ///< Atlas width in pixels
+    uint16_t height; ///< Atlas height in pixels
+    uint16_t count; ///< Number of icon ids
+    uint8_t depth; ///< Bits per pixel, 1 or 16
+} GFXatlas;
@@ -0,0 +1,127 @@
+// Curve flattening for the Bezier primitives of Adafruit_GFX.
+// Quadratic and cubic curves are stepped with adaptive forward differencing
+// (Lien, Shantz and Pratt): the step size is halved while the curve is too bent
+// for a straight chord and doubled again once it flattens out, so flat stretches
+// become one long segment and tight bends get short ones. Everything is
+// integer arithmetic, there is no floating point in the stepping loop.
+//
+// Control points are passed in 24.8 fixed point (1/256 pixel), the sink is
+// called with the end point of every flat segment in the same format. The start
+// point of the curve is not passed to the sink, the end point is exact.
+
+#pragma once
+
+#include <cstdint>
+
+
+namespace gfx_bezier {
+
+static constexpr uint8_t FRAC_BITS { 8 }; ///< Fraction bits of the coordinates passed in and out
+static constexpr uint8_t ACC_SHIFT { 24 }; ///< Extra fraction bits of the difference accumulators
+static constexpr uint8_t MAX_LEVEL { 10 }; ///< At most 2^MAX_LEVEL segments per curve
+/// A second difference above this leaves more than ~1/4 pixel between chord and curve
+static constexpr int64_t HALVE_LIMIT { static_cast<int64_t>(2) << (FRAC_BITS + ACC_SHIFT) };
+/// Doubling the step quadruples the second difference; stay well below HALVE_LIMIT afterwards
+static constexpr int64_t DOUBLE_LIMIT { HALVE_LIMIT / 8 };
+
+/// Forward differences of one coordinate
+struct Axis {
+    int64_t p; ///< Current position
+    int64_t d1; ///< First forward difference
+    int64_t d2; ///< Second forward difference
+    int64_t d3; ///< Third forward difference (constant for a given step size)
+
+    /*!
+        @brief  Set up the differences for step size 1 from the power basis a*t^3 + b*t^2 + c*t + p0
+    */
+    void init(int32_t p0, int64_t a, int64_t b, int64_t c) {
+        p = static_cast<int64_t>(p0) * (1LL << ACC_SHIFT);
+        d1 = (a + b + c) * (1LL << ACC_SHIFT);
+        d2 = (6 * a + 2 * b) * (1LL << ACC_SHIFT);
+        d3 = (6 * a) * (1LL << ACC_SHIFT);
+    }
+
+    int64_t bend() const {
+        const int64_t e0 { d2 < 0 ? -d2 : d2 };
+        const int64_t e1 { d2 + d3 < 0 ? -(d2 + d3) : d2 + d3 };
+        return e0 > e1 ? e0 : e1;
+    }
+
+    void halve() {
+        d1 = (d1 >> 1) - (d2 >> 3) + (d3 >> 4);
+        d2 = (d2 >> 2) - (d3 >> 3);
+        d3 >>= 3;
+    }
+
+    void twice() {
+        d1 = 2 * d1 + d2;
+        d2 = 4 * d2 + 4 * d3;
+        d3 *= 8;
+    }
+
+    void step() {
+        p += d1;
+        d1 += d2;
+        d2 += d3;
+    }
+
+    int32_t value() const {
+        return static_cast<int32_t>((p + (1LL << (ACC_SHIFT - 1))) >> ACC_SHIFT);
+    }
+};
+
+template <typename Sink>
+void flatten(Axis& x, Axis& y, int32_t end_x, int32_t end_y, Sink&& sink) {
+    constexpr uint16_t end { 1 << MAX_LEVEL };
+    uint16_t t { 0 }; // curve parameter in units of 2^-MAX_LEVEL
+    uint8_t level { 0 };
+
+    while (t < end) {
+        while (level < MAX_LEVEL && (x.bend() > HALVE_LIMIT || y.bend() > HALVE_LIMIT)) {
+            x.halve();
+            y.halve();
+            ++level;
+        }
+        while (level > 0 && !(t & ((1 << (MAX_LEVEL - level + 1)) - 1)) && x.bend() < DOUBLE_LIMIT && y.bend() < DOUBLE_LIMIT) {
+            x.twice();
+            y.twice();
+            --level;
+        }
+
+        x.step();
+        y.step();
+        t += 1 << (MAX_LEVEL - level);
+
+        if (t < end) {
+            sink(x.value(), y.value());
+        } else {
+            sink(end_x, end_y); // snap to the exact end point, no accumulated error
+        }
+    }
+}
+
+/*!
+    @brief  Flatten a quadratic Bezier curve, control points in 24.8 fixed point
+*/
+template <typename Sink>
+void flattenQuad(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, Sink&& sink) {
+    Axis x, y;
+    x.init(x0, 0, static_cast<int64_t>(x0) - 2 * x1 + x2, 2 * (static_cast<int64_t>(x1) - x0));
+    y.init(y0, 0, static_cast<int64_t>(y0) - 2 * y1 + y2, 2 * (static_cast<int64_t>(y1) - y0));
+    flatten(x, y, x2, y2, sink);
+}
+
+/*!
+    @brief  Flatten a cubic Bezier curve, control points in 24.8 fixed point
+*/
+template <typename Sink>
+void flattenCubic(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t x3, int32_t y3, Sink&& sink) {
+    Axis x, y;
+    x.init(x0, -static_cast<int64_t>(x0) + 3 * static_cast<int64_t>(x1) - 3 * static_cast<int64_t>(x2) + x3,
+        3 * static_cast<int64_t>(x0) - 6 * static_cast<int64_t>(x1) + 3 * static_cast<int64_t>(x2), 3 * (static_cast<int64_t>(x1) - x0));
+    y.init(y0, -static_cast<int64_t>(y0) + 3 * static_cast<int64_t>(y1) - 3 * static_cast<int64_t>(y2) + y3,
+        3 * static_cast<int64_t>(y0) - 6 * static_cast<int64_t>(y1) + 3 * static_cast<int64_t>(y2), 3 * (static_cast<int64_t>(y1) - y0));
+    flatten(x, y, x3, y3, sink);
+}
+
+} // namespace gfx_bezier
@@ -0,0 +1,17 @@
+// Indexed-color bitmap structure for Adafruit_GFX.
+// A bitmap of palette indexes is made by fontconvert/palconvert, which also
+// emits the palette and the GFXindexedBitmap. Pass the address of the
+// GFXindexedBitmap struct to drawIndexedBitmap().
+
+#pragma once
+
+
+/// Bitmap of 1, 2, 4 or 8 bits per pixel, each pixel an index into an RGB 5/6/5 palette
+typedef struct {
+    const uint8_t* bitmap; ///< Palette indexes packed most significant bits first, rows padded to whole bytes
+    const uint16_t* palette; ///< RGB 5/6/5 colors, up to 2^depth entries
+    uint16_t width; ///< Bitmap width in pixels
+    uint16_t height; ///< Bitmap height in pixels
+    uint8_t depth; ///< Bits per pixel, 1, 2, 4 or 8
+    int16_t transparent; ///< Index of the pixels that aren't drawn, -1 if all are
+} GFXindexedBitmap;
@@ -0,0 +1,18 @@
+// Nine-patch bitmap structure for Adafruit_GFX.
+// A nine-patch is made by fontconvert/ninepatch from an image with guide
+// lines. Pass the address of the GFXninePatch struct and the size of the
+// widget to drawNinePatch().
+
+#pragma once
+
+
+/// RGB 5/6/5 bitmap that SCALES TO ANY SIZE: the corners are drawn once, the edges and the center repeat the stretchable region
+typedef struct {
+    const uint16_t* bitmap; ///< RGB 5/6/5 pixels, width * height words
+    uint16_t width; ///< Bitmap width in pixels
+    uint16_t height; ///< Bitmap height in pixels
+    uint16_t stretchX; ///< First column of the stretchable region
+    uint16_t stretchY; ///< First row of the stretchable region
+    uint16_t stretchWidth; ///< Columns of the stretchable region, at least 1
+    uint16_t stretchHeight; ///< Rows of the stretchable region, at least 1
+} GFXninePatch;
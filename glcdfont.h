@@ -8,7 +8,7 @@
 
 // Standard ASCII 5x7 font
 
-static const unsigned char font[] = {
+static constexpr unsigned char font[] = {
 	0x00, 0x00, 0x00, 0x00, 0x00,
 	0x3E, 0x5B, 0x4F, 0x5B, 0x3E,
 	0x3E, 0x6B, 0x4F, 0x6B, 0x3E,